@@ -1,13 +0,0 @@
-// sine and cosine of the Earth's tilt
-#define COS_ALPHA 0.917060074385124 // cos(23.5)
-#define SIN_ALPHA 0.398749068925246 // sin(23.5)
-
-const float THETA_TABLE[] = {1.000000,0.999577,0.998308,0.996195,0.993238,0.989442,0.984808,0.979341,0.973045,0.965926,0.957990,0.949243,0.939693,0.929348,0.918216,0.906308,0.893633,0.880201,0.866025,0.851117,0.835488,0.819152,0.802123,0.784416,0.766044,0.747025,0.727374,0.707107,0.686242,0.664796,0.642788,0.620235,0.597159,0.573576,0.549509,0.524977,0.500000,0.474600,0.448799,0.422618,0.396080,0.369206,0.342020,0.314545,0.286803,0.258819,0.230616,0.202218,0.173648,0.144932,0.116093,0.087156,0.058145,0.029085,0.000000,-0.029085,-0.058145,-0.087156,-0.116093,-0.144932,-0.173648,-0.202218,-0.230616,-0.258819,-0.286803,-0.314545,-0.342020,-0.369206,-0.396080,-0.422618,-0.448799,-0.474600,-0.500000,-0.524977,-0.549509,-0.573576,-0.597159,-0.620235,-0.642788,-0.664796,-0.686242,-0.707107,-0.727374,-0.747025,-0.766044,-0.784416,-0.802123,-0.819152,-0.835488,-0.851117,-0.866025,-0.880201,-0.893633,-0.906308,-0.918216,-0.929348,-0.939693,-0.949243,-0.957990,-0.965926,-0.973045,-0.979341,-0.984808,-0.989442,-0.993238,-0.996195,-0.998308,-0.999577,-1.000000};
-
-const float PHI_COS_TABLE[] = {0.172419,0.177428,0.182578,0.187873,0.193315,0.198908,0.204657,0.210564,0.216634,0.222869,0.229275,0.235854,0.242610,0.249548,0.256670,0.263981,0.271485,0.279184,0.287082,0.295184,0.303491,0.312008,0.320738,0.329683,0.338847,0.348231,0.357839,0.367671,0.377731,0.388019,0.398537,0.409284,0.420262,0.431470,0.442907,0.454572,0.466462,0.478575,0.490907,0.503455,0.516213,0.529174,0.542333,0.555680,0.569207,0.582903,0.596758,0.610757,0.624888,0.639134,0.653480,0.667905,0.682392,0.696918,0.711461,0.725996,0.740498,0.754940,0.769291,0.783524,0.797605,0.811502,0.825181,0.838608,0.851746,0.864559,0.877010,0.889061,0.900676,0.911816,0.922445,0.932526,0.942024,0.950904,0.959134,0.966683,0.973521,0.979621,0.984960,0.989515,0.993269,0.996204,0.998310,0.999577,1.000000,0.999577,0.998310,0.996204,0.993269,0.989515,0.984960,0.979621,0.973521,0.966683,0.959134,0.950904,0.942024,0.932526,0.922445,0.911816,0.900676,0.889061,0.877010,0.864559,0.851746,0.838608,0.825181,0.811502,0.797605,0.783524,0.769291,0.754940,0.740498,0.725996,0.711461,0.696918,0.682392,0.667905,0.653480,0.639134,0.624888,0.610757,0.596758,0.582903,0.569207,0.555680,0.542333,0.529174,0.516213,0.503455,0.490907,0.478575,0.466462,0.454572,0.442907,0.431470,0.420262,0.409284,0.398537,0.388019,0.377731,0.367671,0.357839,0.348231,0.338847,0.329683,0.320738,0.312008,0.303491,0.295184,0.287082,0.279184,0.271485,0.263981,0.256670,0.249548,0.242610,0.235854,0.229275,0.222869,0.216634,0.210564,0.204657,0.198908,0.193315,0.187873,0.182578,0.177428};
-
-const float PHI_SIN_TABLE[] = {0.985024,0.984134,0.983191,0.982193,0.981137,0.980018,0.978834,0.977580,0.976253,0.974848,0.973362,0.971789,0.970124,0.968362,0.966499,0.964528,0.962443,0.960238,0.957906,0.955441,0.952834,0.950079,0.947168,0.944092,0.940842,0.937409,0.933783,0.929956,0.925915,0.921651,0.917152,0.912407,0.907403,0.902127,0.896568,0.890710,0.884541,0.878047,0.871212,0.864021,0.856460,0.848513,0.840164,0.831396,0.822194,0.812542,0.802422,0.791818,0.780714,0.769095,0.756944,0.744246,0.730986,0.717151,0.702725,0.687698,0.672058,0.655794,0.638898,0.621362,0.603181,0.584350,0.564868,0.544736,0.523955,0.502532,0.480473,0.457789,0.434492,0.410600,0.386130,0.361104,0.335547,0.309486,0.282952,0.255978,0.228599,0.200853,0.172782,0.144427,0.115833,0.087046,0.058112,0.029081,0.000000,-0.029081,-0.058112,-0.087046,-0.115833,-0.144427,-0.172782,-0.200853,-0.228599,-0.255978,-0.282952,-0.309486,-0.335547,-0.361104,-0.386130,-0.410600,-0.434492,-0.457789,-0.480473,-0.502532,-0.523955,-0.544736,-0.564868,-0.584350,-0.603181,-0.621362,-0.638898,-0.655794,-0.672058,-0.687698,-0.702725,-0.717151,-0.730986,-0.744246,-0.756944,-0.769095,-0.780714,-0.791818,-0.802422,-0.812542,-0.822194,-0.831396,-0.840164,-0.848513,-0.856460,-0.864021,-0.871212,-0.878047,-0.884541,-0.890710,-0.896568,-0.902127,-0.907403,-0.912407,-0.917152,-0.921651,-0.925915,-0.929956,-0.933783,-0.937409,-0.940842,-0.944092,-0.947168,-0.950079,-0.952834,-0.955441,-0.957906,-0.960238,-0.962443,-0.964528,-0.966499,-0.968362,-0.970124,-0.971789,-0.973362,-0.974848,-0.976253,-0.977580,-0.978834,-0.980018,-0.981137,-0.982193,-0.983191,-0.984134};
-
-const float YEAR_TABLE[] = {1.000000,0.999852,0.999407,0.998667,0.997630,0.996298,0.994671,0.992749,0.990532,0.988023,0.985220,0.982126,0.978740,0.975065,0.971100,0.966848,0.962309,0.957485,0.952378,0.946988,0.941317,0.935368,0.929141,0.922640,0.915864,0.908818,0.901502,0.893919,0.886071,0.877960,0.869589,0.860961,0.852078,0.842942,0.833556,0.823923,0.814046,0.803928,0.793572,0.782980,0.772157,0.761104,0.749826,0.738326,0.726608,0.714673,0.702527,0.690173,0.677615,0.664855,0.651899,0.638749,0.625411,0.611886,0.598181,0.584298,0.570242,0.556017,0.541628,0.527078,0.512371,0.497513,0.482508,0.467359,0.452072,0.436651,0.421101,0.405426,0.389630,0.373720,0.357698,0.341571,0.325342,0.309017,0.292600,0.276097,0.259512,0.242850,0.226116,0.209315,0.192452,0.175531,0.158559,0.141540,0.124479,0.107381,0.090252,0.073095,0.055917,0.038722,0.021516,0.004304,-0.012910,-0.030120,-0.047321,-0.064508,-0.081676,-0.098820,-0.115935,-0.133015,-0.150055,-0.167052,-0.183998,-0.200891,-0.217723,-0.234491,-0.251190,-0.267814,-0.284359,-0.300820,-0.317191,-0.333469,-0.349647,-0.365723,-0.381689,-0.397543,-0.413279,-0.428892,-0.444378,-0.459733,-0.474951,-0.490029,-0.504961,-0.519744,-0.534373,-0.548843,-0.563151,-0.577292,-0.591261,-0.605056,-0.618671,-0.632103,-0.645348,-0.658402,-0.671260,-0.683919,-0.696376,-0.708627,-0.720667,-0.732494,-0.744104,-0.755493,-0.766659,-0.777597,-0.788305,-0.798779,-0.809017,-0.819015,-0.828770,-0.838280,-0.847541,-0.856551,-0.865307,-0.873807,-0.882048,-0.890028,-0.897743,-0.905193,-0.912375,-0.919286,-0.925925,-0.932289,-0.938377,-0.944188,-0.949718,-0.954967,-0.959933,-0.964614,-0.969010,-0.973118,-0.976938,-0.980469,-0.983709,-0.986658,-0.989314,-0.991677,-0.993747,-0.995521,-0.997001,-0.998186,-0.999074,-0.999667,-0.999963,-0.999963,-0.999667,-0.999074,-0.998186,-0.997001,-0.995521,-0.993747,-0.991677,-0.989314,-0.986658,-0.983709,-0.980469,-0.976938,-0.973118,-0.969010,-0.964614,-0.959933,-0.954967,-0.949718,-0.944188,-0.938377,-0.932289,-0.925925,-0.919286,-0.912375,-0.905193,-0.897743,-0.890028,-0.882048,-0.873807,-0.865307,-0.856551,-0.847541,-0.838280,-0.828770,-0.819015,-0.809017,-0.798779,-0.788305,-0.777597,-0.766659,-0.755493,-0.744104,-0.732494,-0.720667,-0.708627,-0.696376,-0.683919,-0.671260,-0.658402,-0.645348,-0.632103,-0.618671,-0.605056,-0.591261,-0.577292,-0.563151,-0.548843,-0.534373,-0.519744,-0.504961,-0.490029,-0.474951,-0.459733,-0.444378,-0.428892,-0.413279,-0.397543,-0.381689,-0.365723,-0.349647,-0.333469,-0.317191,-0.300820,-0.284359,-0.267814,-0.251190,-0.234491,-0.217723,-0.200891,-0.183998,-0.167052,-0.150055,-0.133015,-0.115935,-0.098820,-0.081676,-0.064508,-0.047321,-0.030120,-0.012910,0.004304,0.021516,0.038722,0.055917,0.073095,0.090252,0.107381,0.124479,0.141540,0.158559,0.175531,0.192452,0.209315,0.226116,0.242850,0.259512,0.276097,0.292600,0.309017,0.325342,0.341571,0.357698,0.373720,0.389630,0.405426,0.421101,0.436651,0.452072,0.467359,0.482508,0.497513,0.512371,0.527078,0.541628,0.556017,0.570242,0.584298,0.598181,0.611886,0.625411,0.638749,0.651899,0.664855,0.677615,0.690173,0.702527,0.714673,0.726608,0.738326,0.749826,0.761104,0.772157,0.782980,0.793572,0.803928,0.814046,0.823923,0.833556,0.842942,0.852078,0.860961,0.869589,0.877960,0.886071,0.893919,0.901502,0.908818,0.915864,0.922640,0.929141,0.935368,0.941317,0.946988,0.952378,0.957485,0.962309,0.966848,0.971100,0.975065,0.978740,0.982126,0.985220,0.988023,0.990532,0.992749,0.994671,0.996298,0.997630,0.998667,0.999407,0.999852};
-
-const float LATITUDE_TABLE[] = {80.071598,79.780078,79.480089,79.171399,78.853767,78.526936,78.190651,77.844654,77.488678,77.122449,76.745689,76.358103,75.959411,75.549305,75.127479,74.693625,74.247436,73.788570,73.316713,72.831516,72.332646,71.819759,71.292502,70.750513,70.193435,69.620901,69.032541,68.427980,67.806842,67.168752,66.513319,65.840163,65.148906,64.439160,63.710542,62.962677,62.195181,61.407680,60.599805,59.771200,58.921503,58.050373,57.157479,56.242492,55.305110,54.345040,53.362011,52.355766,51.326077,50.272741,49.195575,48.094428,46.969188,45.819765,44.646116,43.448229,42.226143,40.979933,39.709725,38.415690,37.098060,35.757109,34.393173,33.006644,31.597971,30.167670,28.716308,27.244524,25.753013,24.242532,22.713907,21.168019,19.605810,18.028281,16.436490,14.831545,13.214606,11.586882,9.949622,8.304114,6.651680,4.993670,3.331457,1.666433,0.000000,-1.666433,-3.331457,-4.993670,-6.651680,-8.304114,-9.949622,-11.586882,-13.214606,-14.831545,-16.436490,-18.028281,-19.605810,-21.168019,-22.713907,-24.242532,-25.753013,-27.244524,-28.716308,-30.167670,-31.597971,-33.006644,-34.393173,-35.757109,-37.098060,-38.415690,-39.709725,-40.979933,-42.226143,-43.448229,-44.646116,-45.819765,-46.969188,-48.094428,-49.195575,-50.272741,-51.326077,-52.355766,-53.362011,-54.345040,-55.305110,-56.242492,-57.157479,-58.050373,-58.921503,-59.771200,-60.599805,-61.407680,-62.195181,-62.962677,-63.710542,-64.439160,-65.148906,-65.840163,-66.513319,-67.168752,-67.806842,-68.427980,-69.032541,-69.620901,-70.193435,-70.750513,-71.292502,-71.819759,-72.332646,-72.831516,-73.316713,-73.788570,-74.247436,-74.693625,-75.127479,-75.549305,-75.959411,-76.358103,-76.745689,-77.122449,-77.488678,-77.844654,-78.190651,-78.526936,-78.853767,-79.171399,-79.480089,-79.780078};
@@ -0,0 +1,29 @@
+#include <stdint.h>
+
+#include "ephemeris.h"
+#include "ephemeris_table.h"
+
+#if EPHEMERIS_EOT_STEPS != EQUATION_OF_TIME_STEPS
+#error "ephemeris_table.h is out of date, rerun tools/gen_ephemeris_table.py"
+#endif
+
+// Sine of the sun's declination at noon UTC, Q15
+int32_t sin_declination(int day) {
+    return EPHEMERIS_SIN_DECLINATION[day];
+}
+
+// Cosine of the sun's declination at noon UTC, Q15. The declination is
+// never more than the Earth's tilt, so the series
+// cos = 1 - sin^2/2 - sin^4/8 - sin^6/16 is good to 5e-5.
+int32_t cos_declination(int day) {
+    int32_t s = EPHEMERIS_SIN_DECLINATION[day];
+    int32_t s2 = (s * s + 16384) >> 15;
+    int32_t s4 = (s2 * s2 + 16384) >> 15;
+    int32_t s6 = (s4 * s2 + 16384) >> 15;
+    return 32768 - ((s2 + 1) >> 1) - ((s4 + 4) >> 3) - ((s6 + 8) >> 4);
+}
+
+// How far the sun is ahead of the clock at noon UTC
+int equation_of_time(int day) {
+    return EPHEMERIS_EQUATION_OF_TIME[day];
+}
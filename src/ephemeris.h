@@ -0,0 +1,13 @@
+// Where the sun is on each day of the year: its declination and the equation
+// of time at noon UTC, looked up in the table tools/gen_ephemeris_table.py
+// generates, with the cosine of declination worked out from the sine.
+
+#include <stdint.h>
+
+// Equation of time is in 1/EQUATION_OF_TIME_STEPS minutes
+#define EQUATION_OF_TIME_STEPS 4
+
+// Both take a day of the year, 0-365 as in tm_yday
+int32_t sin_declination(int day);
+int32_t cos_declination(int day);
+int equation_of_time(int day);
@@ -0,0 +1,59 @@
+// Solar ephemeris for each day of the year, at noon UTC. Generated by
+// tools/gen_ephemeris_table.py, do not edit.
+
+#define EPHEMERIS_EOT_STEPS 4
+
+// Sine of the sun's declination, Q15, indexed by tm_yday
+const int16_t EPHEMERIS_SIN_DECLINATION[] = {
+-12833,-12791,-12744,-12694,-12639,-12580,-12518,-12451,-12381,-12306,-12228,-12146,-12060,-11970,-11877,-11779,
+-11678,-11573,-11465,-11353,-11238,-11119,-10996,-10870,-10741,-10608,-10472,-10333,-10190,-10044,-9896,-9744,
+-9589,-9431,-9270,-9106,-8940,-8771,-8599,-8424,-8247,-8068,-7886,-7701,-7515,-7326,-7134,-6941,
+-6746,-6548,-6349,-6147,-5944,-5739,-5533,-5325,-5115,-4904,-4691,-4477,-4262,-4046,-3828,-3610,
+-3390,-3170,-2948,-2726,-2503,-2280,-2056,-1831,-1606,-1381,-1155,-929,-703,-477,-251,-25,
+201,427,653,878,1103,1327,1551,1774,1997,2219,2440,2660,2879,3098,3315,3531,
+3746,3960,4173,4384,4593,4802,5009,5214,5417,5619,5819,6017,6214,6408,6601,6791,
+6980,7166,7350,7532,7712,7889,8064,8237,8407,8574,8739,8902,9062,9219,9373,9525,
+9674,9820,9963,10103,10241,10375,10507,10635,10760,10882,11002,11117,11230,11340,11446,11549,
+11649,11745,11838,11928,12014,12097,12177,12253,12325,12395,12460,12522,12581,12636,12688,12736,
+12780,12821,12859,12892,12922,12949,12972,12991,13007,13019,13028,13032,13034,13031,13025,13016,
+13003,12986,12965,12941,12914,12883,12848,12810,12768,12723,12674,12621,12566,12506,12443,12377,
+12307,12234,12158,12078,11995,11908,11818,11725,11629,11529,11426,11320,11211,11099,10983,10865,
+10743,10618,10491,10360,10227,10091,9951,9809,9665,9517,9367,9214,9059,8901,8740,8577,
+8411,8243,8073,7900,7725,7548,7369,7187,7004,6818,6630,6441,6249,6056,5860,5664,
+5465,5265,5063,4859,4655,4448,4241,4032,3821,3610,3397,3184,2969,2753,2537,2319,
+2101,1882,1663,1443,1222,1001,779,557,335,113,-110,-332,-555,-778,-1000,-1223,
+-1445,-1667,-1888,-2109,-2330,-2550,-2769,-2988,-3206,-3423,-3639,-3854,-4069,-4282,-4494,-4705,
+-4914,-5122,-5329,-5534,-5738,-5940,-6140,-6339,-6536,-6731,-6924,-7115,-7304,-7491,-7676,-7858,
+-8038,-8216,-8392,-8565,-8735,-8903,-9068,-9231,-9390,-9547,-9701,-9853,-10001,-10146,-10288,-10427,
+-10563,-10696,-10825,-10951,-11074,-11193,-11309,-11422,-11531,-11636,-11738,-11836,-11931,-12022,-12109,-12192,
+-12272,-12348,-12420,-12488,-12552,-12612,-12668,-12721,-12769,-12813,-12854,-12890,-12922,-12950,-12974,-12994,
+-13010,-13022,-13030,-13033,-13033,-13028,-13019,-13006,-12989,-12968,-12943,-12914,-12880,-12843
+};
+
+// Equation of time (how far the sun is ahead of the clock) in
+// 1/EPHEMERIS_EOT_STEPS minutes, indexed by tm_yday
+const int8_t EPHEMERIS_EQUATION_OF_TIME[] = {
+-12,-14,-16,-18,-20,-22,-23,-25,-27,-28,-30,-32,-33,-35,-36,-38,
+-39,-40,-42,-43,-44,-45,-46,-47,-48,-49,-50,-51,-52,-52,-53,-54,
+-54,-55,-55,-56,-56,-56,-57,-57,-57,-57,-57,-57,-57,-57,-56,-56,
+-56,-56,-55,-55,-54,-54,-53,-53,-52,-51,-51,-50,-49,-48,-48,-47,
+-46,-45,-44,-43,-42,-41,-40,-39,-38,-37,-36,-34,-33,-32,-31,-30,
+-29,-27,-26,-25,-24,-23,-21,-20,-19,-18,-17,-15,-14,-13,-12,-11,
+-10,-8,-7,-6,-5,-4,-3,-2,-1,0,1,2,3,4,4,5,
+6,7,7,8,9,9,10,11,11,12,12,12,13,13,13,14,
+14,14,14,14,15,15,15,15,14,14,14,14,14,14,13,13,
+13,12,12,11,11,10,10,9,9,8,7,7,6,5,4,4,
+3,2,1,0,0,-1,-2,-3,-4,-5,-6,-6,-7,-8,-9,-10,
+-11,-12,-12,-13,-14,-15,-16,-16,-17,-18,-19,-19,-20,-20,-21,-22,
+-22,-23,-23,-24,-24,-24,-25,-25,-25,-26,-26,-26,-26,-26,-26,-26,
+-26,-26,-26,-26,-26,-25,-25,-25,-25,-24,-24,-23,-23,-22,-22,-21,
+-20,-20,-19,-18,-17,-16,-15,-15,-14,-13,-12,-11,-10,-8,-7,-6,
+-5,-4,-3,-1,0,1,2,4,5,6,8,9,11,12,13,15,
+16,18,19,20,22,23,25,26,28,29,30,32,33,35,36,37,
+39,40,41,43,44,45,46,48,49,50,51,52,53,54,55,56,
+57,58,59,59,60,61,62,62,63,63,64,64,65,65,65,66,
+66,66,66,66,66,66,66,65,65,65,65,64,64,63,62,62,
+61,60,59,59,58,57,56,54,53,52,51,50,48,47,45,44,
+42,41,39,38,36,34,32,31,29,27,25,23,21,19,18,16,
+14,12,10,8,6,4,2,0,-2,-4,-6,-8,-10,-12
+};
@@ -0,0 +1,96 @@
+#include <pebble.h>
+
+#include "frame_cache.h"
+#include "pebble_worldmap.h"
+#include "render.h"
+
+// Externs
+extern int g_twilight;
+
+// Saved under PERSIST_KEY_FRAME_CACHE, with the profile itself split into
+// PERSIST_DATA_MAX_LENGTH chunks under the keys from PERSIST_KEY_FRAME_CHUNK
+typedef struct {
+    // The map size, day and number of bands the profile is for
+    uint16_t map_width;
+    uint16_t map_height;
+    int16_t day;
+    uint8_t bands;
+    uint8_t chunks;
+} FrameCacheHeader;
+
+// Restore the saved profile if it's for the given day and the current
+// settings. Returns 1 if it was.
+int load_frame_cache(int day) {
+    FrameCacheHeader header;
+    uint8_t data[PROFILE_BYTES(MAX_BANDS)];
+    int i, size;
+
+    if (persist_read_data(PERSIST_KEY_FRAME_CACHE, &header, sizeof(header)) != sizeof(header)) {
+        return 0;
+    }
+    size = PROFILE_BYTES(header.bands);
+    if (header.map_width != MAP_WIDTH || header.map_height != MAP_HEIGHT ||
+            header.day != day || header.bands != (g_twilight ? MAX_BANDS : 1) ||
+            header.chunks != (size + PERSIST_DATA_MAX_LENGTH - 1) / PERSIST_DATA_MAX_LENGTH) {
+        return 0;
+    }
+
+    for (i = 0; i < header.chunks; i++) {
+        int offset = i * PERSIST_DATA_MAX_LENGTH;
+        int length = (size - offset < PERSIST_DATA_MAX_LENGTH) ? size - offset : PERSIST_DATA_MAX_LENGTH;
+        if (persist_read_data(PERSIST_KEY_FRAME_CHUNK + i, data + offset, length) != length) {
+            return 0;
+        }
+    }
+
+    restore_profile(day, header.bands, data);
+    return 1;
+}
+
+// Chunks the largest profile takes
+#define MAX_FRAME_CHUNKS ((PROFILE_BYTES(MAX_BANDS) + PERSIST_DATA_MAX_LENGTH - 1) / PERSIST_DATA_MAX_LENGTH)
+
+// Save the current profile, unless it's the one already saved. The header is
+// removed while the chunks are written, so a save that is cut short is never
+// loaded, and chunks left over from a bigger profile are deleted.
+void save_frame_cache() {
+    FrameCacheHeader header, saved;
+    uint8_t data[PROFILE_BYTES(MAX_BANDS)];
+    int i, bands, size, saved_chunks;
+    int day = save_profile(data, &bands);
+
+    if (day < 0) {
+        return;
+    }
+    size = PROFILE_BYTES(bands);
+
+    header.map_width = MAP_WIDTH;
+    header.map_height = MAP_HEIGHT;
+    header.day = day;
+    header.bands = bands;
+    header.chunks = (size + PERSIST_DATA_MAX_LENGTH - 1) / PERSIST_DATA_MAX_LENGTH;
+
+    // The profile only depends on what's in the header. Without a header it's
+    // not known how many chunks an earlier save got through.
+    if (persist_read_data(PERSIST_KEY_FRAME_CACHE, &saved, sizeof(saved)) == sizeof(saved)) {
+        if (memcmp(&saved, &header, sizeof(header)) == 0) {
+            return;
+        }
+        saved_chunks = saved.chunks;
+    } else {
+        saved_chunks = MAX_FRAME_CHUNKS;
+    }
+
+    persist_delete(PERSIST_KEY_FRAME_CACHE);
+    for (i = 0; i < header.chunks; i++) {
+        int offset = i * PERSIST_DATA_MAX_LENGTH;
+        int length = (size - offset < PERSIST_DATA_MAX_LENGTH) ? size - offset : PERSIST_DATA_MAX_LENGTH;
+        if (persist_write_data(PERSIST_KEY_FRAME_CHUNK + i, data + offset, length) != length) {
+            return;
+        }
+    }
+    for (; i < saved_chunks && i < MAX_FRAME_CHUNKS; i++) {
+        persist_delete(PERSIST_KEY_FRAME_CHUNK + i);
+    }
+    persist_write_data(PERSIST_KEY_FRAME_CACHE, &header, sizeof(header));
+}
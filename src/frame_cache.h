@@ -0,0 +1,4 @@
+// The terminator profile the app last drew with, kept in persistent storage
+// so the next launch can draw the overlay on its first frame
+int load_frame_cache(int day);
+void save_frame_cache();
@@ -0,0 +1,71 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "land_map.h"
+#include "render.h"
+
+// Runs are read through the reader this many at a time, which covers every
+// row of the current map in one go
+#define LAND_MAP_CHUNK 24
+
+LandMapReader g_land_map_reader = 0;
+
+// Where each row's runs start in the map, plus where the last one ends. This
+// is small enough to keep in memory, which saves a read per row.
+uint16_t g_land_map_offsets[MAP_HEIGHT + 1];
+
+void init_land_map(LandMapReader reader) {
+    uint8_t buffer[2 * (MAP_HEIGHT + 1)];
+    int y;
+
+    g_land_map_reader = reader;
+    reader(0, buffer, sizeof(buffer));
+    for (y = 0; y <= MAP_HEIGHT; y++) {
+        g_land_map_offsets[y] = buffer[2 * y] | (buffer[2 * y + 1] << 8);
+    }
+}
+
+// Decode row y of the map into MAP_ROW_WORDS words, land = 1. The row's runs
+// are streamed through the reader. Each run boundary toggles a bit, and a
+// prefix XOR along the row then turns the toggles back into land spans, 32
+// pixels at a time and without a branch per run.
+void read_land_row(int y, uint32_t *land) {
+    uint8_t buffer[LAND_MAP_CHUNK];
+    uint32_t offset = g_land_map_offsets[y];
+    uint32_t end = g_land_map_offsets[y + 1];
+    uint32_t carry = 0;
+    int x = 0, i;
+
+    memset(land, 0, MAP_ROW_WORDS * sizeof(uint32_t));
+
+    // Mark the run boundaries; the row ends where the next one starts. The
+    // last run ends at MAP_WIDTH, which is past the last word when MAP_WIDTH
+    // is a multiple of 32, so that boundary is left out and the padding
+    // cleared below instead.
+    while (offset < end) {
+        int length = (end - offset < LAND_MAP_CHUNK) ? end - offset : LAND_MAP_CHUNK;
+
+        g_land_map_reader(offset, buffer, length);
+        for (i = 0; i < length; i++) {
+            x += buffer[i];
+            if (x < MAP_WIDTH) {
+                land[x >> 5] ^= (uint32_t)1 << (x & 31);
+            }
+        }
+        offset += length;
+    }
+
+    // Each pixel is the parity of the boundaries up to and including it
+    for (i = 0; i < MAP_ROW_WORDS; i++) {
+        uint32_t w = land[i];
+        w ^= w << 1;
+        w ^= w << 2;
+        w ^= w << 4;
+        w ^= w << 8;
+        w ^= w << 16;
+        w ^= carry;
+        land[i] = w;
+        carry = -(w >> 31);
+    }
+    land[MAP_ROW_WORDS - 1] &= MAP_LAST_WORD_MASK;
+}
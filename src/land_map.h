@@ -0,0 +1,11 @@
+// The land map, stored as row spans (see tools/gen_land_map.py) and decoded a
+// row at a time as it's needed. The bytes come through a LandMapReader: the
+// app's reads the map's resource, the host tools' a copy in memory.
+
+#include <stdint.h>
+
+// Copies length bytes of the map, starting at offset, into buffer
+typedef void (*LandMapReader)(uint32_t offset, uint8_t *buffer, int length);
+
+void init_land_map(LandMapReader reader);
+void read_land_row(int y, uint32_t *land);
@@ -0,0 +1,42 @@
+// Display and map geometry, fixed at build time. Round displays get their own
+// map size; either can be overridden with -DMAP_WIDTH=... -DMAP_HEIGHT=...,
+// as long as src/tables/ and the land map resource have been generated for
+// that size (see the Development section of README.md).
+
+#ifdef PBL_ROUND
+// 180x180 round displays
+#define SCREEN_WIDTH 180
+#define SCREEN_HEIGHT 180
+#ifndef MAP_WIDTH
+#define MAP_WIDTH 240
+#define MAP_HEIGHT 180
+#endif
+#else
+// 144x168 rectangular displays
+#define SCREEN_WIDTH 144
+#define SCREEN_HEIGHT 168
+#ifndef MAP_WIDTH
+#define MAP_WIDTH 216
+#define MAP_HEIGHT 168
+#endif
+#endif
+
+// How rows of the map relate to latitude, see tools/gen_angle_tables.py.
+// Columns are always linear in longitude. Build with
+// -DMAP_PROJECTION=PROJECTION_EQUIRECTANGULAR for the other projection, which
+// needs the land map resource pointed at world_map-equirectangular.rle.
+#define PROJECTION_MERCATOR 0
+#define PROJECTION_EQUIRECTANGULAR 1
+#ifndef MAP_PROJECTION
+#define MAP_PROJECTION PROJECTION_MERCATOR
+#endif
+
+// The map spans 360 degrees of longitude across MAP_WIDTH, which must be a
+// multiple of 4, with the equator halfway down MAP_HEIGHT, which must be even
+#define MAP_HALF_WIDTH (MAP_WIDTH / 2)
+#define MAP_EQUATOR (MAP_HEIGHT / 2)
+
+// Rows of the map bitmaps are padded to whole 32-bit words, and the padding
+// bits of the last word are kept clear
+#define MAP_ROW_WORDS ((MAP_WIDTH + 31) >> 5)
+#define MAP_LAST_WORD_MASK ((MAP_WIDTH & 31) ? ((uint32_t)1 << (MAP_WIDTH & 31)) - 1 : 0xFFFFFFFF)
@@ -0,0 +1,18 @@
+// The generated tables for the map size and projection in map_config.h. Only
+// one set is compiled into each build.
+
+#if MAP_PROJECTION == PROJECTION_MERCATOR && MAP_WIDTH == 216 && MAP_HEIGHT == 168
+#include "tables/216x168/angle_tables.h"
+#include "tables/216x168/terminator_table.h"
+#elif MAP_PROJECTION == PROJECTION_MERCATOR && MAP_WIDTH == 240 && MAP_HEIGHT == 180
+#include "tables/240x180/angle_tables.h"
+#include "tables/240x180/terminator_table.h"
+#elif MAP_PROJECTION == PROJECTION_EQUIRECTANGULAR && MAP_WIDTH == 216 && MAP_HEIGHT == 168
+#include "tables/216x168-equirectangular/angle_tables.h"
+#include "tables/216x168-equirectangular/terminator_table.h"
+#elif MAP_PROJECTION == PROJECTION_EQUIRECTANGULAR && MAP_WIDTH == 240 && MAP_HEIGHT == 180
+#include "tables/240x180-equirectangular/angle_tables.h"
+#include "tables/240x180-equirectangular/terminator_table.h"
+#else
+#error "No tables for this map size, run make -C tools tables"
+#endif
@@ -2,48 +2,92 @@
 #include <time.h>
 
 #include "pebble_worldmap.h"
-#include "worldmap_image.h"
-#include "angle_tables.h"
+#include "frame_cache.h"
+#include "land_map.h"
+#include "perf_stats.h"
+#include "render.h"
+#include "sunrise.h"
+#include "world_clock.h"
 
 /* Globals */
 
 // Flag that indicates the window is fully visible
 int g_loaded = 0;
 
+// Flag that the overlay can be drawn before then, as today's terminator
+// profile was saved last time
+int g_overlay_cached = 0;
+
 // Flag that signals a need to regenerate the overlay
 int g_needs_refresh = 0;
 
-// Latitude and longitude of "home"
-int home_latitude;
-int home_longitude;
-
-// Time zone of "home" (in half-hours relative to UTC, e.g. -24-24)
-int home_timezone;
-
-// Enable drawing of sunrise/sunset times
-int g_draw_sunrise = 0;
-
-// Transformed latitude/longitude
-int g_home_pos[] = {0, 0};
+// The one pending update job (see schedule_update()): whatever asks for an
+// update, be it the time, a settings edit or startup, moves this timer rather
+// than adding another
+AppTimer *g_refresh_timer = NULL;
 
-// The time-of-day offset (0-215)
-int g_time_offset = 0;
+// Whether the app is in the foreground, rather than under a notification
+int g_in_focus = 1;
 
-// An offset to correct for true solar time (-3-1)
-int g_solar_offset = 0;
+// Clocks shown: home first if it's shown, then the cities in the order of
+// CITIES
+Clock g_clocks[MAX_CLOCKS];
+int g_clock_count = 0;
 
-// The time-of-year offset (0-365)
-int g_year_offset = 0;
+// The time of day in UTC, in minutes (0-1439), and the UTC day of the year,
+// which is one off g_yday either side of midnight
+int g_utc_minutes = 0;
+int g_utc_day = 0;
 
 // Stored time information
 int g_hour = 0;
 int g_minute = 0;
-
-// Last stored scroll position
-int g_last_offset = 0;
-
+int g_second = 0;
+int g_yday = 0;
+
+// The column of the map at the left edge of the screen (0 to MAP_WIDTH - 1).
+// The map is a whole turn of the globe, so the view wraps around its edges.
+int g_view_x = 0;
+
+// Panning (see pan_step()): -1 west, 1 east or 0 not at all, whether the
+// button is still held, and the columns moved since it was pressed
+int g_pan_direction = 0;
+int g_pan_held = 0;
+int g_pan_columns = 0;
+AppTimer *g_pan_timer = NULL;
+
+// Timings of each phase of a redraw, in ms, and of the redraw as a whole.
+// They're logged every PERF_SAMPLES redraws, and shown on the map while
+// g_show_perf is set (a long press of SELECT in the settings window).
+// Nothing is blitted when rendering to the frame buffer.
+#define PERF_REDRAW     0
+#define PERF_SCAN       1
+#define PERF_COMPOSITE  2
+#ifndef RENDER_TO_FRAMEBUFFER
+#define PERF_BLIT       3
+#define PERF_CLOCKS     4
+#define PERF_PHASES     5
+#else
+#define PERF_CLOCKS     3
+#define PERF_PHASES     4
+#endif
+PerfStat g_perf[PERF_PHASES] = {
+    [PERF_REDRAW] = {.name = "redraw"},
+    [PERF_SCAN] = {.name = "scan"},
+    [PERF_COMPOSITE] = {.name = "composite"},
+#ifndef RENDER_TO_FRAMEBUFFER
+    [PERF_BLIT] = {.name = "blit"},
+#endif
+    [PERF_CLOCKS] = {.name = "clocks"}
+};
+int g_show_perf = 0;
+
+// Overlay refreshes, and how many of them needed the whole overlay rendered
+int g_refreshes = 0;
+int g_full_renders = 0;
+
+#ifndef RENDER_TO_FRAMEBUFFER
 // Reverse-engineered internals of the GBitmap struct
-#define ROW_SIZE(width) (width>>3)
 void init_bitmap(GBitmap *bmp, int width, int height, void *data) {
   // width must be a multiple of 32?
   bmp->row_size_bytes = width >> 3; // 8 pixels per byte
@@ -54,281 +98,409 @@ void init_bitmap(GBitmap *bmp, int width, int height, void *data) {
   bmp->bounds.size.h = height;
   bmp->addr = data;
 }
+#endif
 
 // Window object
 Window *g_window;
 
+#ifndef RENDER_TO_FRAMEBUFFER
 // Bitmap we're drawing into
 GBitmap g_bmp;
 
 // Pixel data for the bitmap
-char g_bmpdata[ROW_SIZE(224)*168];
-
-
-// Calculate the longitude cos/sin
-void calc_theta(int x_offset, float *cos_theta, float *sin_theta) {
-    int offset;
-    offset = x_offset % 216;
-    if (offset > 108) offset = 216 - offset;
-    *cos_theta = THETA_TABLE[offset];
-    offset = (x_offset + 54) % 216;
-    if (offset > 108) offset = 216 - offset;
-    *sin_theta = THETA_TABLE[offset];
-}
-
-// Calculate the latitude cos/sin
-void calc_phi(int y, float *cos_phi, float *sin_phi) {
-    *cos_phi = PHI_COS_TABLE[y];
-    *sin_phi = PHI_SIN_TABLE[y];
-}
-
-// Calculate the dot product of the position on the earth and the direction to the sun:
-// <cos(phi)*cos(theta)*cos(alpha) + sin(phi)*sin(alpha), cos(phi)*sin(theta)> * <cos_year, sin_year>
-float calc_dp(float cos_phi, float sin_phi, float cos_theta, float sin_theta, float cos_year, float sin_year) {
-    return (cos_phi * cos_theta * COS_ALPHA + sin_phi * SIN_ALPHA) * cos_year
-        + cos_phi * sin_theta * sin_year;
-}
-
-// Shift solar noon to account for the discrepancy with true solar time
-// From http://en.wikipedia.org/wiki/Equation_of_time, first equation
-int equation_of_time(int date) {
-    if (date < 6) { return -1; }
-    if (date < 29) { return -2; }
-    if (date < 55) { return -3; }
-    if (date < 81) { return -2; }
-    if (date < -104) { return -1; }
-    if (date < 163) { return 0; }
-    if (date < 241) { return -1; }
-    if (date < 259) { return 0; }
-    if (date < 279) { return 1; }
-    if (date < 324) { return 2; }
-    if (date < 342) { return 1; }
-    if (date < 356) { return 0; }
-    return -1;
+uint32_t g_bmpdata[MAP_ROW_WORDS*MAP_HEIGHT];
+#endif
+
+// The land map resource, read a row at a time while rendering
+ResHandle g_land_map;
+
+void read_land_map_resource(uint32_t offset, uint8_t *buffer, int length) {
+    resource_load_byte_range(g_land_map, offset, buffer, length);
 }
 
-// Main rendering function for our only layer
-void layer_update_callback(Layer *me, GContext* ctx) {
-    (void)me;
-    (void)ctx;
-    int x, y;
-    GRect destination;
-
-    // Calculate rotation around the sun
-    float cos_year = YEAR_TABLE[g_year_offset % 365];
-    float sin_year = YEAR_TABLE[(g_year_offset + 91) % 365];
-
-    // Use the full screen
-    destination.origin.x = 0;
-    destination.origin.y = 0;
-    destination.size.w = 216;
-    destination.size.h = 168;
-
-    if (g_needs_refresh) {
-        // Render the image in WORLD_MAP_IMAGE into the bmpdata bitmap
-        memset(g_bmpdata, 0, ROW_SIZE(224)*168);
-        for (x = 0; x < 216; x++) {
-            // Calculate the Earth's daily rotation (rotates once every 24 hours
-            // plus once every year).
-            int x_offset = x + g_time_offset - g_solar_offset + (g_year_offset * 6 / 10);
-            float cos_theta, sin_theta;
-            calc_theta(x_offset, &cos_theta, &sin_theta);
-
-            for (y = 0; y < 168; y++) {
-                // Get the input map's pixel value
-                int addr = x + y * 216;
-                char in_val = WORLD_MAP_IMAGE[addr/8] & (1<<(addr%8));
-                float cos_phi, sin_phi, dp;
-
-                calc_phi(y, &cos_phi, &sin_phi);
-                dp = calc_dp(cos_phi, sin_phi, cos_theta, sin_theta, cos_year, sin_year);
-
-                // If the dot product is negative, the sun is up.
-                // If the dot product is positive, it's nighttime.
-                int val = 0;
-                if (in_val != 0) {
-                    // Land masses!
-                    char stipple = ((x % 2) == 0 && (y % 2) == 0) ? 0 : 1;
-                    if (dp > 0) val = 1;
-                    else val = stipple;
-                } else {
-                    // Water
-                    char stipple = (((x + y) % 2) == 0) ? 1 : 0;
-                    if (dp > 0) val = stipple;
-                    else val = 0;
-                }
-
-                // If necessary, set the appropriate bit in the output bitmap
-                if (val == 0) {
-                    g_bmpdata[y*ROW_SIZE(224) + x/8] |= (1 << (x%8));
-                }
-            }
-        }
+
+// A clock in ms for timing, which only needs to go forwards
+uint32_t perf_clock() {
+    time_t s;
+    uint16_t ms;
+    time_ms(&s, &ms);
+    return (uint32_t)s * 1000 + ms;
+}
+
+// Write the timings to the log
+void log_perf() {
+    char line[40];
+    int i;
+
+    APP_LOG(APP_LOG_LEVEL_DEBUG, "ms min/mean/p95/max, %d refreshes, %d full",
+            g_refreshes, g_full_renders);
+    for (i = 0; i < PERF_PHASES; i++) {
+        perf_format(&g_perf[i], line, sizeof(line));
+        APP_LOG(APP_LOG_LEVEL_DEBUG, "%s", line);
     }
+}
 
-    // Render the map
-    graphics_draw_bitmap_in_rect(ctx, &g_bmp, destination);
-
-    if (g_draw_sunrise) {
-        // Text to show the time for the next sunrise/sunset
-        char g_sunrise[32];
-
-        // Calculate sunrise/sunset time
-        float last_dp = 0;
-        int sunrise_x = -1, sunset_x = -1;
-
-        // Calculate the latitude
-        float cos_phi, sin_phi;
-        calc_phi(g_home_pos[1], &cos_phi, &sin_phi);
-
-        // Traverse from home coordinates going East until we hit a boundary
-        for (x = 0; x < 216; x++) {
-            // Calculate the Earth's daily rotation (rotates once every 24 hours
-            // plus once every year)
-            int x_offset = g_home_pos[0] + x + g_time_offset - g_solar_offset + (g_year_offset * 6 / 10);
-            float cos_theta, sin_theta, dp;
-
-            calc_theta(x_offset, &cos_theta, &sin_theta);
-            dp = calc_dp(cos_phi, sin_phi, cos_theta, sin_theta, cos_year, sin_year);
-
-            if (last_dp < 0 && dp > 0) {
-                // Sunset!
-                sunset_x = x;
-            } else if (last_dp > 0 && dp < 0) {
-                // Sunrise!
-                sunrise_x = x;
-            }
+#ifdef RENDER_TO_FRAMEBUFFER
+// Regenerate the overlay. The map is composited from scratch on every redraw,
+// so all there is to do is ask for one.
+void refresh_overlay() {
+    g_refreshes++;
+    g_full_renders++;
+    g_needs_refresh = 0;
+    layer_mark_dirty(window_get_root_layer(g_window));
+}
 
-            // No boundary; keep going
-            last_dp = dp;
-        }
+// Composite the visible part of the map, from column g_view_x on, into the
+// frame buffer
+void draw_map(Layer *me, GContext* ctx) {
+    GBitmap *frame_buffer = graphics_capture_frame_buffer(ctx);
+    if (!frame_buffer) {
+        return;
+    }
 
-        if (sunrise_x >= 0 && sunset_x >= 0) {
-            // Calculate the time of the crossing
-            struct tm time;
-            int minutes;
-            char time_buf[6];
-
-            // Sunrise
-            minutes = g_minute + (sunrise_x * 1440) / 216;
-            time.tm_hour = (g_hour + (minutes / 60)) % 24;
-            time.tm_min = minutes % 60;
-            if (clock_is_24h_style()) {
-                strftime(time_buf, 20, "%H:%M", &time);
-            } else {
-                strftime(time_buf, 20, "%I:%M%p", &time);
-            }
+    int x_offset = g_view_x;
+
+    // Frame buffer rows are a whole number of words
+    uint32_t *dest = (uint32_t *)frame_buffer->addr;
+    int row_words = frame_buffer->row_size_bytes >> 2;
+    int rows = frame_buffer->bounds.size.h;
+    if (g_loaded || g_overlay_cached) {
+        // The profile is only scanned when the day changes; timed on its own
+        // here, so render_map_window() finds it done
+        uint32_t start = perf_clock();
+        update_profile(g_yday);
+        perf_add(&g_perf[PERF_SCAN], perf_clock() - start);
+
+        start = perf_clock();
+        render_map_window(dest, row_words, rows, x_offset,
+                g_yday, calc_rotation(g_yday, g_utc_minutes));
+        perf_add(&g_perf[PERF_COMPOSITE], perf_clock() - start);
+    } else {
+        // Just the map while the slide-in animation is happening
+        render_bare_map_window(dest, row_words, rows, x_offset);
+    }
 
-            strcpy(g_sunrise, "rise ");
-            strcat(g_sunrise, time_buf);
-
-            // Sunset
-            minutes = g_minute + (sunset_x * 1440) / 216 + 25;
-            time.tm_hour = (g_hour + (minutes / 60)) % 24;
-            time.tm_min = minutes % 60;
-            if (clock_is_24h_style()) {
-                strftime(time_buf, 20, "%H:%M", &time);
-            } else {
-                strftime(time_buf, 20, "%I:%M%p", &time);
-            }
+    graphics_release_frame_buffer(ctx, frame_buffer);
+}
+#else
+// Time spent compositing the render in progress so far, over all its slices
+uint32_t g_render_ms = 0;
+
+// Composite strips of the map until this slice's time budget is used up, then
+// yield to the event loop so button presses are handled, and carry on from a
+// timer. The rows rendered so far are shown as we go.
+void render_slice() {
+    time_t start_s, now_s;
+    uint16_t start_ms, now_ms;
+    int done;
+
+    time_ms(&start_s, &start_ms);
+    do {
+        done = render_map_continue(g_bmpdata, RENDER_STRIP_ROWS);
+        time_ms(&now_s, &now_ms);
+    } while (!done && (now_s - start_s) * 1000 + now_ms - start_ms < RENDER_SLICE_MS);
+
+    g_render_ms += (now_s - start_s) * 1000 + now_ms - start_ms;
+    if (done) {
+        perf_add(&g_perf[PERF_COMPOSITE], g_render_ms);
+    }
+
+    layer_mark_dirty(window_get_root_layer(g_window));
 
-            strcat(g_sunrise, " set ");
-            strcat(g_sunrise, time_buf);
+    if (!done) {
+        app_timer_register(RENDER_SLICE_INTERVAL_MS, handle_timer, (void *)TIMER_ID_RENDER_SLICE);
+    } else if (g_needs_refresh) {
+        // The time changed while we were rendering
+        refresh_overlay();
+    }
+}
+
+// Regenerate the overlay. If the terminator has just moved by a few columns
+// only the pixels it swept over are updated, right away; a full render is
+// spread over several event-loop slices by render_slice().
+void refresh_overlay() {
+    if (render_in_progress()) {
+        // Picked up when the current render finishes
+        return;
+    }
+
+    // Unset the "needs refresh" flag
+    g_needs_refresh = 0;
+    g_refreshes++;
+
+    uint32_t start = perf_clock();
+    update_profile(g_yday);
+    perf_add(&g_perf[PERF_SCAN], perf_clock() - start);
+
+    int rotation = calc_rotation(g_yday, g_utc_minutes);
+    start = perf_clock();
+    if (update_map(g_bmpdata, g_yday, rotation) < 0) {
+        g_full_renders++;
+        g_render_ms = perf_clock() - start;
+        render_map_start(g_yday, rotation);
+        render_slice();
+        return;
+    }
+    perf_add(&g_perf[PERF_COMPOSITE], perf_clock() - start);
+    layer_mark_dirty(window_get_root_layer(g_window));
+}
+
+// Blit the map to the screen from column g_view_x on. The bitmap holds every
+// column of the globe, so panning only moves where the blit starts: it's done
+// in two pieces, the columns up to the right edge of the map and then those
+// from its left edge, and nothing is composited.
+void draw_map(Layer *me, GContext* ctx) {
+    GBitmap piece = g_bmp;
+    int width = MAP_WIDTH - g_view_x;
+    if (width > SCREEN_WIDTH) width = SCREEN_WIDTH;
+
+    uint32_t start = perf_clock();
+    piece.bounds.origin.x = g_view_x;
+    piece.bounds.size.w = width;
+    graphics_draw_bitmap_in_rect(ctx, &piece, GRect(0, 0, width, MAP_HEIGHT));
+    if (width < SCREEN_WIDTH) {
+        piece.bounds.origin.x = 0;
+        piece.bounds.size.w = SCREEN_WIDTH - width;
+        graphics_draw_bitmap_in_rect(ctx, &piece,
+                GRect(width, 0, SCREEN_WIDTH - width, MAP_HEIGHT));
+    }
+    perf_add(&g_perf[PERF_BLIT], perf_clock() - start);
+}
+#endif
+
+// Write minutes after midnight as a time of day, in the user's 12/24 hour
+// style
+void format_time(char *buf, int minutes) {
+    struct tm time;
+    time.tm_hour = minutes / 60;
+    time.tm_min = minutes % 60;
+    if (clock_is_24h_style()) {
+        strftime(buf, 8, "%H:%M", &time);
+    } else {
+        strftime(buf, 8, "%I:%M%p", &time);
+    }
+}
+
+// Write the line of text for g_clocks[i]. Home shows its next sunrise and
+// sunset; a city its code, local time and whichever of them is next.
+void format_clock(int i, char *line) {
+    Clock *clock = &g_clocks[i];
+    char time_buf[8];
+
+    if (!clock->code) {
+        if (clock->sun == SUN_RISES_AND_SETS) {
+            format_time(time_buf, clock->sunrise);
+            strcpy(line, "rise ");
+            strcat(line, time_buf);
+            format_time(time_buf, clock->sunset);
+            strcat(line, " set ");
+            strcat(line, time_buf);
+        } else if (clock->sun == SUN_ALWAYS_UP) {
+            strcpy(line, "Sun up all day");
         } else {
             // If this happens to you, I feel sorry for you
-            strcpy(g_sunrise, "No sunrise/sunset");
+            strcpy(line, "Sun down all day");
         }
+        return;
+    }
+
+    strcpy(line, clock->code);
+    strcat(line, " ");
+    format_time(time_buf, clock->minutes);
+    strcat(line, time_buf);
+    if (clock->sun == SUN_RISES_AND_SETS) {
+        // Whichever comes next; by day that's sunset
+        strcat(line, clock->is_day ? " set " : " rise ");
+        format_time(time_buf, clock->is_day ? clock->sunset : clock->sunrise);
+        strcat(line, time_buf);
+    } else {
+        strcat(line, (clock->sun == SUN_ALWAYS_UP) ? " sun up" : " sun down");
+    }
+}
+
+// Draw the timings over the top of the map
+void draw_perf(GContext *ctx) {
+    char line[40];
+    int i;
+
+    graphics_context_set_fill_color(ctx, GColorWhite);
+    graphics_fill_rect(ctx, GRect(0, 0, SCREEN_WIDTH, 14 * (PERF_PHASES + 1)), 0, GCornerNone);
+    graphics_context_set_text_color(ctx, GColorBlack);
+
+    snprintf(line, sizeof(line), "%d refreshes, %d full", g_refreshes, g_full_renders);
+    graphics_draw_text(ctx, line, fonts_get_system_font(FONT_KEY_GOTHIC_14),
+            GRect(2, -2, SCREEN_WIDTH - 2, 14), GTextOverflowModeTrailingEllipsis,
+            GTextAlignmentLeft, NULL);
+    for (i = 0; i < PERF_PHASES; i++) {
+        perf_format(&g_perf[i], line, sizeof(line));
+        graphics_draw_text(ctx, line, fonts_get_system_font(FONT_KEY_GOTHIC_14),
+                GRect(2, 14 * (i + 1) - 2, SCREEN_WIDTH - 2, 14),
+                GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+    }
+}
+
+// Main rendering function for our only layer
+void layer_update_callback(Layer *me, GContext* ctx) {
+    uint32_t redraw_start = perf_clock();
+    int i;
 
+    // Render the map
+    draw_map(me, ctx);
+
+    // Solving for sunrise and sunset only happens when a clock's day
+    // changes, otherwise this is a few additions per clock
+    uint32_t start = perf_clock();
+    update_clocks(g_clocks, g_clock_count, g_utc_day, g_utc_minutes);
+    perf_add(&g_perf[PERF_CLOCKS], perf_clock() - start);
+
+    // Markers: home is white in a black square, the cities black squares
+    // with a white dot by day. Their columns are relative to the view, and
+    // one just west of it is drawn at the left edge.
+    for (i = 0; i < g_clock_count; i++) {
+        Clock *clock = &g_clocks[i];
+        int x = (clock->x - g_view_x + MAP_WIDTH) % MAP_WIDTH;
+        if (x > MAP_WIDTH - 3) x -= MAP_WIDTH;
         graphics_context_set_fill_color(ctx, GColorBlack);
-        graphics_fill_rect(ctx, GRect(g_home_pos[0]-2, g_home_pos[1]-2, 5, 5), 0, GCornerNone);
-        graphics_context_set_fill_color(ctx, GColorWhite);
-        graphics_fill_rect(ctx, GRect(g_home_pos[0]-1, g_home_pos[1]-1, 3, 3), 0, GCornerNone);
+        if (!clock->code) {
+            graphics_fill_rect(ctx, GRect(x-2, clock->y-2, 5, 5), 0, GCornerNone);
+            graphics_context_set_fill_color(ctx, GColorWhite);
+            graphics_fill_rect(ctx, GRect(x-1, clock->y-1, 3, 3), 0, GCornerNone);
+        } else {
+            graphics_fill_rect(ctx, GRect(x-1, clock->y-1, 3, 3), 0, GCornerNone);
+            if (clock->is_day) {
+                graphics_context_set_fill_color(ctx, GColorWhite);
+                graphics_fill_rect(ctx, GRect(x, clock->y, 1, 1), 0, GCornerNone);
+            }
+        }
+    }
 
+    // A line of text per clock at the bottom of the screen
+    if (g_clock_count > 0) {
+        int top = SCREEN_HEIGHT - 16 * g_clock_count;
         graphics_context_set_fill_color(ctx, GColorWhite);
-        graphics_fill_rect(ctx, GRect(0, 168-16, 144, 16), 0, GCornerNone);
-
+        graphics_fill_rect(ctx, GRect(0, top, SCREEN_WIDTH, 16 * g_clock_count), 0, GCornerNone);
         graphics_context_set_text_color(ctx, GColorBlack);
+    }
+    for (i = 0; i < g_clock_count; i++) {
+        char line[40];
+        format_clock(i, line);
         graphics_draw_text(ctx,
-                g_sunrise,
+                line,
                 fonts_get_system_font(FONT_KEY_FONT_FALLBACK),
-                GRect(5, 168-16, 144-5, 16),
-                GTextOverflowModeWordWrap,
+                GRect(5, SCREEN_HEIGHT - 16 * (g_clock_count - i), SCREEN_WIDTH-5, 16),
+                GTextOverflowModeTrailingEllipsis,
                 GTextAlignmentLeft,
                 NULL);
     }
 
-    // Unset the "needs refresh" flag
-    g_needs_refresh = 0;
+    perf_add(&g_perf[PERF_REDRAW], perf_clock() - redraw_start);
+    if (g_perf[PERF_REDRAW].next == 0) {
+        log_perf();
+    }
+    if (g_show_perf) {
+        draw_perf(ctx);
+    }
 }
 
-// Animate the layer position to a given X offset
-void animate_layer(int destination) {
-    static GRect from_rect = {
-        .origin = {
-            .x = 0,
-            .y = 0
-        },
-        .size = {
-            .w = 216,
-            .h = 168
-        }
-    };
-    static GRect to_rect = {
-        .origin = {
-            .x = 0,
-            .y = 0
-        },
-        .size = {
-            .w = 216,
-            .h = 168
-        }
-    };
-    from_rect.origin.x = g_last_offset;
-    to_rect.origin.x = destination;
-    PropertyAnimation *prop_anim = property_animation_create_layer_frame(
-            window_get_root_layer(g_window), &from_rect, &to_rect);
-    animation_set_duration((Animation*)prop_anim, 1000);
-    animation_schedule((Animation*)prop_anim);
+// Move the view one step in g_pan_direction, and keep going every
+// PAN_FRAME_MS while the button is held, or until a tap has moved
+// PAN_CLICK_COLUMNS
+void pan_step() {
+    g_view_x = (g_view_x + g_pan_direction * PAN_STEP + MAP_WIDTH) % MAP_WIDTH;
+    g_pan_columns += PAN_STEP;
+    layer_mark_dirty(window_get_root_layer(g_window));
+
+    if (g_pan_held || g_pan_columns < PAN_CLICK_COLUMNS) {
+        g_pan_timer = app_timer_register(PAN_FRAME_MS, handle_timer, (void *)TIMER_ID_PAN);
+    } else {
+        g_pan_timer = NULL;
+        g_pan_direction = 0;
+    }
+}
 
-    g_last_offset = destination;
+// Stop panning where the view is
+void stop_pan() {
+    if (g_pan_timer) {
+        app_timer_cancel(g_pan_timer);
+        g_pan_timer = NULL;
+    }
+    g_pan_direction = 0;
+    g_pan_held = 0;
 }
 
 
-// Handle click on the "up" button (scroll left)
-void up_single_click_handler(ClickRecognizerRef recognizer, Window *window) {
-    (void)recognizer;
-    (void)window;
+// Handle the "up" button going down (pan west) or the "down" button (pan
+// east)
+void pan_down_handler(ClickRecognizerRef recognizer, void *context) {
+    (void)context;
 
-    animate_layer(0);
+    stop_pan();
+    g_pan_direction = (click_recognizer_get_button_id(recognizer) == BUTTON_ID_UP) ? -1 : 1;
+    g_pan_held = 1;
+    g_pan_columns = 0;
+    pan_step();
 }
 
 
-// Handle click on the "down" button (scroll right)
-void down_single_click_handler(ClickRecognizerRef recognizer, Window *window) {
+// Handle the button coming up again, which lets a pan that's gone far enough
+// stop at its next step
+void pan_up_handler(ClickRecognizerRef recognizer, void *context) {
     (void)recognizer;
-    (void)window;
+    (void)context;
 
-    animate_layer(-72);
+    g_pan_held = 0;
 }
 
 
 // Handle click on the "select" button (displays settings dialog)
 void select_single_click_handler(ClickRecognizerRef recognizer, Window *window) {
+    // The pan button's release would go to the settings window
+    stop_pan();
     show_settings_window();
 }
 
 
 // Register our input handlers
 void click_config_provider(void *context) {
-    window_single_repeating_click_subscribe(BUTTON_ID_UP, 100, (ClickHandler) up_single_click_handler);
-    window_single_repeating_click_subscribe(BUTTON_ID_DOWN, 100, (ClickHandler) down_single_click_handler);
+    window_raw_click_subscribe(BUTTON_ID_UP, pan_down_handler, pan_up_handler, NULL);
+    window_raw_click_subscribe(BUTTON_ID_DOWN, pan_down_handler, pan_up_handler, NULL);
     window_single_click_subscribe(BUTTON_ID_SELECT, (ClickHandler) select_single_click_handler);
 }
 
+// Store the current time & date
+void read_time(struct tm *time) {
+    g_hour = time->tm_hour;
+    g_minute = time->tm_min;
+    g_second = time->tm_sec;
+    g_yday = time->tm_yday;
+
+    // Time of day in UTC (the time zone is in half-hours)
+    int minutes = g_hour * 60 + g_minute - g_settings.timezone * 30;
+    g_utc_day = g_yday + ((minutes < 0) ? -1 : (minutes >= 1440) ? 1 : 0);
+    g_utc_minutes = (minutes + 1440) % 1440;
+}
+
+// Set up the clocks for home and the cities in the settings
+void set_clocks() {
+    int i;
+
+    g_clock_count = 0;
+    if (g_settings.show_home) {
+        set_clock(&g_clocks[0], g_settings.latitude, g_settings.longitude, g_settings.timezone);
+        g_clocks[0].code = NULL;
+        g_clock_count++;
+    }
+    for (i = 0; i < CITY_COUNT && g_clock_count < MAX_CLOCKS; i++) {
+        if ((g_settings.cities >> i) & 1) {
+            Clock *clock = &g_clocks[g_clock_count++];
+            set_clock(clock, CITIES[i].latitude, CITIES[i].longitude, CITIES[i].timezone);
+            clock->code = CITIES[i].code;
+        }
+    }
+}
+
 // Initialization routine
 void handle_init() {
-    int y;
-
     // Create fullscreen window
     g_window = window_create();
     window_set_fullscreen(g_window, 1);
@@ -341,26 +513,43 @@ void handle_init() {
     layer_set_update_proc(window_get_root_layer(g_window),
             &layer_update_callback);
 
-    // Initialize the bitmap structure
-    init_bitmap(&g_bmp, 224, 168, g_bmpdata);
+    // Initialize the settings window, which reads the settings
+    init_settings();
 
-    // Render just the map while slide-in animation is happening,
-    for (y = 0; y < 168; y++) {
-        memcpy(&g_bmpdata[y*ROW_SIZE(224)], &WORLD_MAP_IMAGE[y*27], ROW_SIZE(224));
-    }
-    for (y = 0; y < 168*ROW_SIZE(224); y++) {
-        g_bmpdata[y] ^= 0xFF;
-    }
+    g_land_map = resource_get_handle(RESOURCE_ID_WORLD_MAP);
+    init_land_map(read_land_map_resource);
 
-    // Initialize the settings window
-    init_settings();
+    // If the terminator profile saved on exit is for today, the overlay can
+    // be drawn right away
+    time_t rawtime;
+    time(&rawtime);
+    read_time(localtime(&rawtime));
+    g_overlay_cached = load_frame_cache(g_yday);
+
+#ifndef RENDER_TO_FRAMEBUFFER
+    // Initialize the bitmap structure
+    init_bitmap(&g_bmp, MAP_ROW_WORDS*32, MAP_HEIGHT, g_bmpdata);
+
+    // Render the overlay in one go, which with the saved profile costs about
+    // as much as the map alone, or else just the map while the slide-in
+    // animation is happening. Either way the refresh below only does what
+    // has changed.
+    if (g_overlay_cached) {
+        render_map(g_bmpdata, g_yday, calc_rotation(g_yday, g_utc_minutes));
+    } else {
+        render_bare_map(g_bmpdata);
+    }
+#endif
 
     // After half a second start rendering the sunlight map, as it is slow
-    app_timer_register(500, handle_timer, (void *)TIMER_ID_REFRESH);
+    request_refresh();
 }
 
 
 void handle_deinit() {
+    log_perf();
+    flush_settings();
+    save_frame_cache();
     window_destroy(g_window);
 }
 
@@ -369,25 +558,90 @@ void handle_deinit() {
 void update_time(struct tm *time) {
     // Don't do anything until we're fully visible on-screen
     if (g_loaded) {
-        int utc_hour;
+        int last_yday = g_yday;
+        int last_rotation = calc_rotation(g_yday, g_utc_minutes);
+
+        read_time(time);
+
+        // Only regenerate the overlay if the terminator has moved by at least
+        // a column; other updates just redraw the clocks' text
+        if (g_yday != last_yday || calc_rotation(g_yday, g_utc_minutes) != last_rotation) {
+            g_needs_refresh = 1;
+        }
+        if (g_needs_refresh) {
+            refresh_overlay();
+        } else if (g_clock_count > 0) {
+            layer_mark_dirty(window_get_root_layer(g_window));
+        }
+    }
+}
 
-        // Time-of-year offset (0-365)
-        // 8-day offset accounts for time between winter solstice and new year's
-        g_year_offset = (time->tm_yday + 8) % 365;
 
-        // Time-of-day offset (0-216)
-        utc_hour = time->tm_hour * 2 + 24 - home_timezone;
-        g_time_offset = (((time->tm_min + utc_hour * 30) * 3) / 20) % 216;
+// Run the update job in delay_ms, whether or not it is already pending
+void schedule_job(uint32_t delay_ms) {
+    if (!g_refresh_timer || !app_timer_reschedule(g_refresh_timer, delay_ms)) {
+        g_refresh_timer = app_timer_register(delay_ms, handle_timer, (void *)TIMER_ID_REFRESH);
+    }
+}
+
+// Refresh the overlay REFRESH_DELAY_MS from now. If a refresh is already
+// pending it is pushed back instead, so it happens once the requests stop.
+void request_refresh() {
+    g_needs_refresh = 1;
+    schedule_job(REFRESH_DELAY_MS);
+}
+
+// Whether to save power: the battery is low and not charging
+int low_battery() {
+    BatteryChargeState battery = battery_state_service_peek();
+    return !battery.is_charging && battery.charge_percent <= LOW_BATTERY_PERCENT;
+}
 
-        g_solar_offset = equation_of_time(time->tm_yday);
+// Minutes from the current minute until the next one at which the screen
+// changes: the terminator moves a column (or LOW_BATTERY_COLUMNS), a city
+// clock ticks over (every LOW_BATTERY_MINUTES), home's sunrise or sunset
+// passes, or the day changes
+int minutes_to_next_update() {
+    int now = g_hour * 60 + g_minute;
+    int low = low_battery();
+    int columns = low ? LOW_BATTERY_COLUMNS : 1;
+    int rotation = calc_rotation(g_yday, g_utc_minutes);
+    int limit = 1440 - now;
+    int i, m;
+
+    update_clocks(g_clocks, g_clock_count, g_utc_day, g_utc_minutes);
+    if (g_clock_count > (g_settings.show_home ? 1 : 0)) {
+        int clock_minutes = low ? LOW_BATTERY_MINUTES : 1;
+        if (clock_minutes < limit) limit = clock_minutes;
+    }
+    if (g_settings.show_home && g_clocks[0].sun == SUN_RISES_AND_SETS) {
+        // These are always later today or tomorrow
+        int events[2] = {g_clocks[0].sunrise, g_clocks[0].sunset};
+        for (i = 0; i < 2; i++) {
+            int until = (events[i] - now + 1440) % 1440;
+            if (until > 0 && until < limit) limit = until;
+        }
+    }
 
-        g_hour = time->tm_hour;
-        g_minute = time->tm_min;
+    // The terminator moves about a column every 1440 / MAP_WIDTH minutes, so
+    // this takes a few steps
+    for (m = 1; m < limit; m++) {
+        int moved = (calc_rotation(g_yday, (g_utc_minutes + m) % 1440) - rotation +
+                MAP_WIDTH) % MAP_WIDTH;
+        if (moved > MAP_HALF_WIDTH) moved = MAP_WIDTH - moved;
+        if (moved >= columns) break;
+    }
+    return m;
+}
 
-        // Trigger a refresh
-        g_needs_refresh = 1;
-        layer_mark_dirty(window_get_root_layer(g_window));
+// Set the job for the next time the screen changes, just after the minute
+// turns over. Nothing is scheduled while the app is out of focus; it catches
+// up when it's back.
+void schedule_update() {
+    if (!g_in_focus) {
+        return;
     }
+    schedule_job((minutes_to_next_update() * 60 - g_second) * 1000 + UPDATE_SLACK_MS);
 }
 
 
@@ -395,31 +649,59 @@ void update_time(struct tm *time) {
 void handle_timer(void *data) {
     int cookie = (int)data;
     if (cookie == TIMER_ID_REFRESH) {
+        g_refresh_timer = NULL;
+
         // Indicate that we can start expensive rendering
         g_loaded = 1;
 
-        // Indicate we need to rendered overlay
-        g_needs_refresh = 1;
-
-        // Update the time-based state
+        // Update the time-based state, which only refreshes the overlay if
+        // the terminator has moved or a refresh was asked for
         time_t rawtime;
         time(&rawtime);
         struct tm *tick_time = localtime(&rawtime);
         update_time(tick_time);
+        schedule_update();
+    }
+#ifndef RENDER_TO_FRAMEBUFFER
+    else if (cookie == TIMER_ID_RENDER_SLICE) {
+        // Carry on with a progressive render, unless turning the twilight
+        // bands on or off has abandoned it (see set_twilight()); the refresh
+        // that asked for starts another
+        if (render_in_progress()) {
+            render_slice();
+        }
+    }
+#endif
+    else if (cookie == TIMER_ID_FLUSH_SETTINGS) {
+        flush_settings();
+    }
+    else if (cookie == TIMER_ID_PAN) {
+        pan_step();
     }
 }
 
 
-// Handle clock ticks
-void handle_tick(struct tm *tick_time, TimeUnits units_changed) {
-    update_time(tick_time);
+// Stop updating while a notification covers the app, and catch up right
+// away when it's gone
+void handle_focus(bool in_focus) {
+    g_in_focus = in_focus;
+    if (!in_focus) {
+        // The button may come up while we're covered
+        stop_pan();
+        if (g_refresh_timer) {
+            app_timer_cancel(g_refresh_timer);
+            g_refresh_timer = NULL;
+        }
+    } else if (g_loaded) {
+        schedule_job(0);
+    }
 }
 
 
 // Main entry point for the app
 int main(void) {
     handle_init();
-    tick_timer_service_subscribe(HOUR_UNIT, handle_tick);
+    app_focus_service_subscribe(handle_focus);
     app_event_loop();
     handle_deinit();
 }
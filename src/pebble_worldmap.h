@@ -1,14 +1,100 @@
 // Can be used to distinguish between multiple timers in your app
 #define TIMER_ID_REFRESH 1
+#define TIMER_ID_RENDER_SLICE 2
+#define TIMER_ID_FLUSH_SETTINGS 3
+#define TIMER_ID_PAN 4
 
+// A refresh happens this long after the last request for one
+#define REFRESH_DELAY_MS 500
+
+// Updates driven by the time happen this long after the minute turns over,
+// so the clock has certainly reached it
+#define UPDATE_SLACK_MS 100
+
+// On low battery (LOW_BATTERY_PERCENT or less, and not charging) the map is
+// only updated once the terminator has moved LOW_BATTERY_COLUMNS columns, and
+// the city clocks every LOW_BATTERY_MINUTES
+#define LOW_BATTERY_PERCENT 20
+#define LOW_BATTERY_COLUMNS 3
+#define LOW_BATTERY_MINUTES 5
+
+// Edited settings are saved once there have been no edits for this long, or
+// when the settings window closes
+#define SETTINGS_FLUSH_MS 3000
+
+// While UP or DOWN is held the map pans west or east by PAN_STEP columns
+// every PAN_FRAME_MS, wrapping around the globe. A tap still moves it at least
+// PAN_CLICK_COLUMNS, an hour of longitude. A pan frame only moves where the
+// map bitmap is blitted from; without the bitmap each one is a full
+// composite, so there are half as many frames at the same speed.
+#ifndef RENDER_TO_FRAMEBUFFER
+#define PAN_STEP 3
+#define PAN_FRAME_MS 33
+#else
+#define PAN_STEP 6
+#define PAN_FRAME_MS 66
+#endif
+#define PAN_CLICK_COLUMNS (MAP_WIDTH / 24)
+
+// A full render is done progressively: strips of RENDER_STRIP_ROWS rows are
+// composited until RENDER_SLICE_MS have passed, then the app yields to the
+// event loop for RENDER_SLICE_INTERVAL_MS before carrying on
+#define RENDER_STRIP_ROWS 8
+#define RENDER_SLICE_MS 20
+#define RENDER_SLICE_INTERVAL_MS 10
+
+// The map is composited into a bitmap of the whole globe, which is blitted to
+// the screen: a minute's tick only updates the pixels the terminator swept
+// over, and panning only moves where the blit starts. Building with
+// -DRENDER_TO_FRAMEBUFFER composites the visible rows straight into the frame
+// buffer on every redraw instead, which saves the bitmap's RAM but makes each
+// redraw, pan frames included, a full composite. 1-bit displays only.
+#if defined(RENDER_TO_FRAMEBUFFER) && defined(PBL_COLOR)
+#error "RENDER_TO_FRAMEBUFFER needs a 1-bit display"
+#endif
+
+// Settings as they were saved before the settings record, one per key; they
+// are read once to make the record and then deleted
 #define PERSIST_KEY_SHOW_HOME   1
 #define PERSIST_KEY_LATITUDE    2
 #define PERSIST_KEY_LONGITUDE   3
 #define PERSIST_KEY_TIMEZONE    4
+#define PERSIST_KEY_TWILIGHT    5
+
+// The saved terminator profile (see frame_cache.c): a header, then chunks
+// under consecutive keys
+#define PERSIST_KEY_FRAME_CACHE 6
+#define PERSIST_KEY_FRAME_CHUNK 100
+
+// The settings record
+#define PERSIST_KEY_SETTINGS    7
+
+// Bumped when fields are added to Settings, which only ever happens at the
+// end, so an older record can be read as the start of the current one
+#define SETTINGS_VERSION 2
+
+typedef struct {
+    uint8_t version;
+    // Draw the home marker and sunrise/sunset times
+    uint8_t show_home;
+    uint8_t twilight;
+    // Time zone of "home", in half-hours relative to UTC (-23 to 24)
+    int8_t timezone;
+    // Latitude and longitude of "home", in degrees
+    int16_t latitude;
+    int16_t longitude;
+    // Version 2: bit i shows the clock of CITIES[i] (see world_clock.c)
+    uint16_t cities;
+} Settings;
 
 // pebble_worldmap.c
 void handle_timer(void *data);
+void refresh_overlay();
+void request_refresh();
+void set_clocks();
 
 // settings.c
+extern Settings g_settings;
 void init_settings();
+void flush_settings();
 void show_settings_window();
@@ -0,0 +1,48 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "perf_stats.h"
+
+void perf_add(PerfStat *stat, uint32_t value) {
+    stat->samples[stat->next] = (value > 0xFFFF) ? 0xFFFF : value;
+    stat->next = (stat->next + 1) % PERF_SAMPLES;
+    if (stat->count < PERF_SAMPLES) {
+        stat->count++;
+    }
+}
+
+void perf_summarize(const PerfStat *stat, PerfSummary *summary) {
+    uint16_t sorted[PERF_SAMPLES];
+    uint32_t sum = 0;
+    int i, j;
+
+    summary->count = stat->count;
+    if (stat->count == 0) {
+        summary->min = summary->mean_tenths = summary->p95 = summary->max = 0;
+        return;
+    }
+
+    // Insertion sort: there are only a few samples, and this is only done
+    // when they are logged or shown
+    for (i = 0; i < stat->count; i++) {
+        uint16_t value = stat->samples[i];
+        sum += value;
+        for (j = i; j > 0 && sorted[j - 1] > value; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = value;
+    }
+
+    summary->min = sorted[0];
+    summary->max = sorted[stat->count - 1];
+    summary->mean_tenths = (sum * 10 + stat->count / 2) / stat->count;
+    // The smallest sample that at least 95% of them are no greater than
+    summary->p95 = sorted[(stat->count * 95 + 99) / 100 - 1];
+}
+
+void perf_format(const PerfStat *stat, char *buf, int size) {
+    PerfSummary summary;
+    perf_summarize(stat, &summary);
+    snprintf(buf, size, "%s %d/%d.%d/%d/%d", stat->name, summary.min,
+            summary.mean_tenths / 10, summary.mean_tenths % 10, summary.p95, summary.max);
+}
@@ -0,0 +1,33 @@
+// Timing statistics: the last PERF_SAMPLES durations of something, kept in a
+// ring buffer, and their minimum, mean, 95th percentile and maximum. The
+// durations are measured by the caller.
+
+#include <stdint.h>
+
+#define PERF_SAMPLES 32
+
+typedef struct {
+    const char *name;
+    uint16_t samples[PERF_SAMPLES];
+    // Samples held (up to PERF_SAMPLES) and where the next one goes
+    uint8_t count;
+    uint8_t next;
+} PerfStat;
+
+typedef struct {
+    int count;
+    int min;
+    // In tenths, as the samples are often only a few units
+    int mean_tenths;
+    int p95;
+    int max;
+} PerfSummary;
+
+// Add a sample, overwriting the oldest once the ring is full
+void perf_add(PerfStat *stat, uint32_t value);
+
+// Summarise the samples held; all zero if there are none
+void perf_summarize(const PerfStat *stat, PerfSummary *summary);
+
+// Write "name min/mean/p95/max" into buf, which has room for size bytes
+void perf_format(const PerfStat *stat, char *buf, int size);
@@ -0,0 +1,52 @@
+#include <stdint.h>
+
+#include "projection.h"
+
+// The row of a latitude is interpolated from LATITUDE_ROW_TABLE, which holds
+// the rows north of the equator of each whole degree in 1/PROJECTION_ROW_STEPS
+// rows, and the latitude of a row north of the equator is LATITUDE_TABLE[row].
+// Both are generated with the angle tables (see tools/gen_angle_tables.py) in
+// src/tables/, and render.c includes them through map_tables.h.
+#define PROJECTION_ROW_STEPS 256
+
+extern const int16_t LATITUDE_TABLE[];
+extern const uint16_t LATITUDE_ROW_TABLE[];
+
+int projection_x(int32_t longitude) {
+    // Rounded to the nearest column, as column x is drawn at x * 360 /
+    // MAP_WIDTH degrees east of 180 W
+    int32_t x = ((longitude + 180 * PROJECTION_DEGREE) * MAP_WIDTH +
+            180 * PROJECTION_DEGREE) / (360 * PROJECTION_DEGREE);
+    x %= MAP_WIDTH;
+    return (x < 0) ? x + MAP_WIDTH : x;
+}
+
+int projection_y(int32_t latitude) {
+    int32_t magnitude = (latitude < 0) ? -latitude : latitude;
+    int degree = magnitude / PROJECTION_DEGREE;
+    int32_t rows;
+
+    if (degree >= 90) {
+        rows = LATITUDE_ROW_TABLE[90];
+    } else {
+        int32_t lo = LATITUDE_ROW_TABLE[degree];
+        int32_t hi = LATITUDE_ROW_TABLE[degree + 1];
+        rows = lo + (hi - lo) * (magnitude % PROJECTION_DEGREE) / PROJECTION_DEGREE;
+    }
+
+    // The map is symmetric about the equator, which is row MAP_EQUATOR
+    rows = (rows + PROJECTION_ROW_STEPS / 2) / PROJECTION_ROW_STEPS;
+    return (latitude < 0) ? MAP_EQUATOR + rows : MAP_EQUATOR - rows;
+}
+
+int32_t projection_longitude(int x) {
+    return x * 360 * PROJECTION_DEGREE / MAP_WIDTH - 180 * PROJECTION_DEGREE;
+}
+
+int32_t projection_latitude(int y) {
+    // Rows south of the equator mirror those north of it
+    if (y > MAP_EQUATOR) {
+        return -LATITUDE_TABLE[2 * MAP_EQUATOR - y];
+    }
+    return LATITUDE_TABLE[y];
+}
@@ -0,0 +1,24 @@
+// Conversions between latitude/longitude and map pixels for the projection
+// and map size in map_config.h, in constant time: a row's latitude is read
+// from the angle tables, and a latitude's row interpolated between the rows
+// of the whole degrees either side.
+
+#include <stdint.h>
+
+#include "map_config.h"
+
+// Angles are in 1/PROJECTION_DEGREE degrees, longitudes east and latitudes
+// north positive
+#define PROJECTION_DEGREE 64
+
+// Column of a longitude (0 to MAP_WIDTH-1), as the map is drawn before it is
+// rotated to the time of day
+int projection_x(int32_t longitude);
+
+// Row of a latitude. Latitudes nearer the poles than the map reaches give a
+// row off the map, < 0 or >= MAP_HEIGHT.
+int projection_y(int32_t latitude);
+
+// Longitude of a column and latitude of a row: the inverse of the above
+int32_t projection_longitude(int x);
+int32_t projection_latitude(int y);
@@ -0,0 +1,603 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "ephemeris.h"
+#include "land_map.h"
+#include "render.h"
+#include "map_tables.h"
+
+/* Globals */
+
+// Whether the twilight bands are drawn, see set_twilight()
+RENDER_STATE int g_twilight = 0;
+
+// The profile of each band for the current day, indexed by column of hour
+// angle from midnight (folded, see fold_hour_angle()): whether the band
+// covers the column's top row, and up to BAND_TOGGLES rows further down
+// where it starts or stops covering it (MAP_HEIGHT for none). The shape only
+// depends on the time of year; the time of day just rotates it.
+RENDER_STATE int g_profile_day = -1;
+RENDER_STATE int g_profile_bands = 0;
+RENDER_STATE uint8_t g_band_top[MAX_BANDS][MAP_HALF_WIDTH + 1];
+RENDER_STATE uint8_t g_band_row[MAX_BANDS][BAND_TOGGLES][MAP_HALF_WIDTH + 1];
+
+// The day and rotation of the last finished render, so update_map() knows
+// which columns have moved since
+RENDER_STATE int g_rendered_day = -1;
+RENDER_STATE int g_rendered_rotation = 0;
+
+// State of the render in progress: the next row to composite, each band's
+// mask of that row, and for each band toggle and row the first of a list of
+// columns (linked by g_job_column_next, 0xFF-terminated) where the band starts
+// or stops there
+RENDER_STATE int g_job_row = MAP_HEIGHT;
+RENDER_STATE int g_job_day = 0;
+RENDER_STATE int g_job_rotation = 0;
+RENDER_STATE int g_job_bands = 1;
+RENDER_STATE uint32_t g_job_night[MAX_BANDS][MAP_ROW_WORDS];
+RENDER_STATE uint8_t g_job_row_first[MAX_BANDS * BAND_TOGGLES][MAP_HEIGHT];
+RENDER_STATE uint8_t g_job_column_next[MAX_BANDS * BAND_TOGGLES][MAP_WIDTH];
+
+// Columns changed by update_map(), and the rows to flip in each: start..end-1,
+// or if outside is set, every row but those
+RENDER_STATE uint8_t g_flip_column[MAP_WIDTH];
+RENDER_STATE uint8_t g_flip_start[MAP_WIDTH];
+RENDER_STATE uint8_t g_flip_end[MAP_WIDTH];
+RENDER_STATE uint8_t g_flip_outside[MAP_WIDTH];
+
+// Sine of how far the sun is below the horizon where each band starts, Q15:
+// night (or with twilight on, civil twilight) at 0 degrees, then nautical
+// twilight at 6, astronomical twilight at 12 and night at 18
+const int32_t BAND_SIN_DEPRESSION[MAX_BANDS] = {0, 3425, 6813, 10126};
+
+// Stipple patterns for land and water at each level, from day to night, for
+// each row modulo 4, 32 pixels at a time. A set bit means a black pixel.
+// They are ordered dithers: each level adds pixels to the one before, land
+// going from 12 to 16 black pixels in 16 and water from 0 to 8.
+#define STIPPLE_LEVELS 5
+#define STIPPLE_DAY    0
+#define STIPPLE_NIGHT  (STIPPLE_LEVELS - 1)
+const uint32_t STIPPLE_LAND[4][STIPPLE_LEVELS] = {
+    {0xAAAAAAAA, 0xAAAAAAAA, 0xEEEEEEEE, 0xEEEEEEEE, 0xFFFFFFFF},
+    {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+    {0xAAAAAAAA, 0xBBBBBBBB, 0xBBBBBBBB, 0xFFFFFFFF, 0xFFFFFFFF},
+    {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF}
+};
+const uint32_t STIPPLE_WATER[4][STIPPLE_LEVELS] = {
+    {0x00000000, 0x11111111, 0x55555555, 0x55555555, 0x55555555},
+    {0x00000000, 0x00000000, 0x00000000, 0x22222222, 0xAAAAAAAA},
+    {0x00000000, 0x44444444, 0x55555555, 0x55555555, 0x55555555},
+    {0x00000000, 0x00000000, 0x00000000, 0x88888888, 0xAAAAAAAA}
+};
+
+
+// Cosine of column x of hour angle (Q15). THETA_TABLE only holds a quarter
+// turn: the cosine is even about 0 and odd about a quarter turn.
+int32_t cos_column(int x) {
+    x %= MAP_WIDTH;
+    if (x > MAP_HALF_WIDTH) x = MAP_WIDTH - x;
+    if (x > MAP_WIDTH / 4) {
+        return -ANGLE_Q15(THETA_TABLE[MAP_HALF_WIDTH - x]);
+    }
+    return ANGLE_Q15(THETA_TABLE[x]);
+}
+
+// Calculate the longitude cos/sin (Q15)
+void calc_theta(int x_offset, int32_t *cos_theta, int32_t *sin_theta) {
+    *cos_theta = cos_column(x_offset);
+    *sin_theta = cos_column(x_offset + MAP_WIDTH / 4);
+}
+
+// Calculate the latitude cos/sin (Q15). The tables stop at the equator, as
+// each row south of it is the mirror of one north of it.
+void calc_phi(int y, int32_t *cos_phi, int32_t *sin_phi) {
+    if (y <= MAP_EQUATOR) {
+        *cos_phi = ANGLE_Q15(PHI_COS_TABLE[y]);
+        *sin_phi = ANGLE_Q15(PHI_SIN_TABLE[y]);
+    } else {
+        *cos_phi = ANGLE_Q15(PHI_COS_TABLE[2 * MAP_EQUATOR - y]);
+        *sin_phi = -ANGLE_Q15(PHI_SIN_TABLE[2 * MAP_EQUATOR - y]);
+    }
+}
+
+// Calculate the latitude-independent terms of the dot product below, so that
+// dp = cos(phi)*a + sin(phi)*b:
+// a = cos(theta)*cos(delta)
+// b = -sin(delta)
+// where theta is the hour angle from midnight and delta the sun's
+// declination. All inputs and outputs are Q15. These only change once per
+// column.
+void calc_dp_terms(int32_t cos_theta, int32_t sin_delta, int32_t cos_delta,
+        int32_t *a, int32_t *b) {
+    *a = (cos_theta * cos_delta) >> 15;
+    *b = -sin_delta;
+}
+
+// Calculate the dot product of the position on the earth and the direction
+// away from the sun, which is positive at night:
+// <cos(phi)*cos(theta), cos(phi)*sin(theta), sin(phi)> * <cos(delta), 0, -sin(delta)>
+// Inputs are Q15, the result is Q30. The watch has no FPU, so this is kept
+// to two integer multiplies per pixel.
+int32_t calc_dp(int32_t cos_phi, int32_t sin_phi, int32_t a, int32_t b) {
+    return cos_phi * a + sin_phi * b;
+}
+
+// Composite row y of the map into row, from the night mask of each of bands
+// bands for that row
+void stipple_row(uint32_t *row, int y, const uint32_t night[][MAP_ROW_WORDS], int bands) {
+    const uint32_t *land_stipple = STIPPLE_LAND[y & 3];
+    const uint32_t *water_stipple = STIPPLE_WATER[y & 3];
+    uint32_t land_row[MAP_ROW_WORDS];
+    int i;
+
+    read_land_row(y, land_row);
+
+    // The bands are nested, so each one just overrides the level of the one
+    // before it. The last band is always night.
+    if (bands == 1) {
+        for (i = 0; i < MAP_ROW_WORDS; i++) {
+            uint32_t land = land_row[i];
+            uint32_t night_val, day_val;
+
+            night_val = (land & land_stipple[STIPPLE_NIGHT]) | (~land & water_stipple[STIPPLE_NIGHT]);
+            day_val = (land & land_stipple[STIPPLE_DAY]) | (~land & water_stipple[STIPPLE_DAY]);
+
+            // Set bits are white in the output bitmap
+            row[i] = ~((night[0][i] & night_val) | (~night[0][i] & day_val));
+        }
+    } else {
+        for (i = 0; i < MAP_ROW_WORDS; i++) {
+            uint32_t land = land_row[i];
+            uint32_t value = (land & land_stipple[STIPPLE_DAY]) | (~land & water_stipple[STIPPLE_DAY]);
+
+            // Unrolled for the four bands, as the compiler won't
+            value ^= (value ^ ((land & land_stipple[1]) | (~land & water_stipple[1]))) & night[0][i];
+            value ^= (value ^ ((land & land_stipple[2]) | (~land & water_stipple[2]))) & night[1][i];
+            value ^= (value ^ ((land & land_stipple[3]) | (~land & water_stipple[3]))) & night[2][i];
+            value ^= (value ^ ((land & land_stipple[4]) | (~land & water_stipple[4]))) & night[3][i];
+            row[i] = ~value;
+        }
+    }
+
+    // Clear the padding past the right edge of the map
+    row[MAP_ROW_WORDS - 1] &= MAP_LAST_WORD_MASK;
+}
+
+// Composite row y of the map into row, continuing the render started by
+// render_map_start(). g_job_night holds the band masks of the row above;
+// XORing in the columns where each band starts or stops at this row turns
+// them into this row's.
+void composite_row(uint32_t *row, int y) {
+    int x, list;
+
+    for (list = 0; list < g_job_bands * BAND_TOGGLES; list++) {
+        uint32_t *night = g_job_night[list / BAND_TOGGLES];
+        for (x = g_job_row_first[list][y]; x != 0xFF; x = g_job_column_next[list][x]) {
+            night[x >> 5] ^= (uint32_t)1 << (x & 31);
+        }
+    }
+
+    stipple_row(row, y, (const uint32_t (*)[MAP_ROW_WORDS])g_job_night, g_job_bands);
+}
+
+// Composite rows y_start..y_end-1 of the map into the bmpdata bitmap, 32
+// pixels at a time
+void composite_rows(uint32_t *bmpdata, int y_start, int y_end) {
+    int y;
+
+    for (y = y_start; y < y_end; y++) {
+        composite_row(&bmpdata[y * MAP_ROW_WORDS], y);
+    }
+}
+
+// Read the next nibble of a packed stream, low nibble first
+int read_nibble(const uint8_t *data, int *nibble) {
+    int value = (data[*nibble >> 1] >> ((*nibble & 1) * 4)) & 15;
+    (*nibble)++;
+    return value;
+}
+
+// Unpack the night rows of one declination bucket of TERMINATOR_ROWS (from 1,
+// as bucket 0 isn't stored) into rows[0..MAP_HALF_WIDTH]. The first row is a
+// whole byte, then each nibble is how far the row moved up since the previous
+// column, and nibble 15 is followed by an absolute row in the next two
+// nibbles.
+void decode_terminator_rows(int bucket, uint8_t *rows) {
+    const uint8_t *data = &TERMINATOR_ROWS[TERMINATOR_OFFSETS[bucket - 1]];
+    int nibble = 0, h;
+
+    rows[0] = data[0];
+    for (h = 1; h <= MAP_HALF_WIDTH; h++) {
+        int delta = read_nibble(data + 1, &nibble);
+        if (delta == 15) {
+            int high = read_nibble(data + 1, &nibble);
+            rows[h] = (high << 4) | read_nibble(data + 1, &nibble);
+        } else {
+            rows[h] = rows[h - 1] - delta;
+        }
+    }
+}
+
+// Fold a column of hour angle into the half-wave stored in the table
+int fold_hour_angle(int h) {
+    if (h >= MAP_WIDTH) h -= MAP_WIDTH;
+    return (h > MAP_HALF_WIDTH) ? MAP_WIDTH - h : h;
+}
+
+// Calculate the profile of the terminator, and with bands of MAX_BANDS the
+// three twilight bands, by walking down each column of hour angle and
+// comparing dp with the sine of each band's depression. The bands are nested,
+// as they test the same dp. Each covers an interval of rows or all but one, so
+// it starts or stops at most twice.
+void scan_band_profiles(int day, int bands) {
+    int32_t sin_delta = sin_declination(day);
+    int32_t cos_delta = cos_declination(day);
+    int h, y, band;
+
+    for (h = 0; h <= MAP_HALF_WIDTH; h++) {
+        int32_t cos_theta, sin_theta, a, b;
+        uint8_t toggles[MAX_BANDS];
+
+        calc_theta(h, &cos_theta, &sin_theta);
+        calc_dp_terms(cos_theta, sin_delta, cos_delta, &a, &b);
+
+        for (y = 0; y < MAP_HEIGHT; y++) {
+            int32_t cos_phi, sin_phi;
+            calc_phi(y, &cos_phi, &sin_phi);
+            int32_t dp = calc_dp(cos_phi, sin_phi, a, b);
+
+            for (band = 0; band < bands; band++) {
+                int night = dp > (BAND_SIN_DEPRESSION[band] << 15);
+                if (y == 0) {
+                    g_band_top[band][h] = night;
+                    g_band_row[band][0][h] = g_band_row[band][1][h] = MAP_HEIGHT;
+                    toggles[band] = 0;
+                } else if (night != ((g_band_top[band][h] + toggles[band]) & 1) &&
+                        toggles[band] < BAND_TOGGLES) {
+                    g_band_row[band][toggles[band]++][h] = y;
+                }
+            }
+        }
+    }
+}
+
+// Recalculate the band profiles if the day or the twilight setting has
+// changed. Without twilight there's just the terminator, which is a lookup
+// into the precomputed table in terminator_table.h, interpolated between the
+// two nearest declination buckets, except around the equinoxes.
+void update_profile(int day) {
+    uint8_t rows_lo[MAP_HALF_WIDTH + 1], rows_hi[MAP_HALF_WIDTH + 1];
+    int h;
+
+    if (g_profile_day == day && g_profile_bands == (g_twilight ? MAX_BANDS : 1)) {
+        return;
+    }
+
+    int32_t sin_delta = sin_declination(day);
+    int pos = ((sin_delta < 0) ? -sin_delta : sin_delta) * (TERMINATOR_BUCKETS - 1);
+    int bucket = pos / TERMINATOR_SIN_MAX;
+    int frac = pos % TERMINATOR_SIN_MAX;
+
+    // Within a bucket of an equinox the terminator doesn't interpolate (see
+    // tools/gen_terminator_table.py), so it's scanned like the twilight bands
+    if (g_twilight || bucket == 0) {
+        g_profile_bands = g_twilight ? MAX_BANDS : 1;
+        scan_band_profiles(day, g_profile_bands);
+        g_profile_day = day;
+        return;
+    }
+
+    decode_terminator_rows(bucket, rows_lo);
+    decode_terminator_rows((bucket + 1 < TERMINATOR_BUCKETS) ? bucket + 1 : bucket, rows_hi);
+
+    for (h = 0; h <= MAP_HALF_WIDTH; h++) {
+        // Number of rows in darkness from the top of the map, over
+        // MAP_HEIGHT + 1 rows
+        int night_rows = (rows_lo[h] * (TERMINATOR_SIN_MAX - frac) + rows_hi[h] * frac +
+                TERMINATOR_SIN_MAX / 2) / TERMINATOR_SIN_MAX;
+
+        if (sin_delta <= 0) {
+            // Northern winter: the night side is at the top
+            g_band_top[0][h] = night_rows > 0;
+            g_band_row[0][0][h] = (night_rows > 0 && night_rows < MAP_HEIGHT) ? night_rows : MAP_HEIGHT;
+        } else {
+            // Northern summer: mirror north to south
+            int day_rows = MAP_HEIGHT + 1 - night_rows;
+            g_band_top[0][h] = day_rows <= 0;
+            g_band_row[0][0][h] = (day_rows > 0 && day_rows < MAP_HEIGHT) ? day_rows : MAP_HEIGHT;
+        }
+        g_band_row[0][1][h] = MAP_HEIGHT;
+    }
+
+    g_profile_day = day;
+    g_profile_bands = 1;
+}
+
+// Copy the profile of each band in use into data, which has room for
+// PROFILE_BYTES(bands), so it can be saved across launches. Returns the day
+// it's for, or -1 if there isn't one yet.
+int save_profile(uint8_t *data, int *bands) {
+    int band, size = MAP_HALF_WIDTH + 1;
+
+    if (g_profile_day < 0) {
+        return -1;
+    }
+    for (band = 0; band < g_profile_bands; band++) {
+        memcpy(data, g_band_top[band], size);
+        memcpy(data + size, g_band_row[band], BAND_TOGGLES * size);
+        data += (1 + BAND_TOGGLES) * size;
+    }
+    *bands = g_profile_bands;
+    return g_profile_day;
+}
+
+// Restore a profile saved by save_profile(), so the next render of that day
+// doesn't have to calculate it
+void restore_profile(int day, int bands, const uint8_t *data) {
+    int band, size = MAP_HALF_WIDTH + 1;
+
+    for (band = 0; band < bands; band++) {
+        memcpy(g_band_top[band], data, size);
+        memcpy(g_band_row[band], data + size, BAND_TOGGLES * size);
+        data += (1 + BAND_TOGGLES) * size;
+    }
+    g_profile_day = day;
+    g_profile_bands = bands;
+}
+
+// Turn the twilight bands on or off. Whatever was rendered before has to be
+// rendered again, and a render in progress is abandoned: it was started with
+// the old bands, and finishing it would mark them as rendered.
+void set_twilight(int enabled) {
+    g_twilight = enabled;
+    g_rendered_day = -1;
+    g_job_row = MAP_HEIGHT;
+}
+
+// Calculate the Earth's rotation as a column offset in 0..MAP_WIDTH-1:
+// adding it to a map column gives that column's hour angle from midnight.
+// utc_minutes is the time of day in UTC; the equation of time moves the sun
+// ahead of or behind the clock.
+int calc_rotation(int day, int utc_minutes) {
+    // A day later is a whole turn later, which keeps this positive
+    int apparent = (utc_minutes + 1440) * EQUATION_OF_TIME_STEPS + equation_of_time(day);
+
+    // The day is MAP_WIDTH columns long, and the Greenwich meridian is the
+    // middle column; round to the nearest column
+    int steps_per_day = 1440 * EQUATION_OF_TIME_STEPS;
+    int rotation = (apparent * MAP_WIDTH + steps_per_day / 2) / steps_per_day + MAP_HALF_WIDTH;
+    return rotation % MAP_WIDTH;
+}
+
+// Start rendering the sunlight overlay for the given day and rotation. The
+// rows are then composited by render_map_continue(), a strip at a time if
+// need be; rows that haven't been reached yet keep their old contents.
+void render_map_start(int day, int rotation) {
+    int x, band, toggle;
+
+    update_profile(day);
+    g_job_bands = g_profile_bands;
+
+    // Bucket the columns by the rows where each band starts or stops, and
+    // start from the band masks of the top row
+    memset(g_job_row_first, 0xFF, sizeof(g_job_row_first));
+    memset(g_job_night, 0, sizeof(g_job_night));
+    for (x = MAP_WIDTH - 1; x >= 0; x--) {
+        int h = fold_hour_angle(x + rotation);
+
+        for (band = 0; band < g_job_bands; band++) {
+            if (g_band_top[band][h]) {
+                g_job_night[band][x >> 5] |= (uint32_t)1 << (x & 31);
+            }
+            for (toggle = 0; toggle < BAND_TOGGLES; toggle++) {
+                int list = band * BAND_TOGGLES + toggle;
+                int row = g_band_row[band][toggle][h];
+                if (row < MAP_HEIGHT) {
+                    g_job_column_next[list][x] = g_job_row_first[list][row];
+                    g_job_row_first[list][row] = x;
+                }
+            }
+        }
+    }
+
+    g_job_day = day;
+    g_job_rotation = rotation;
+    g_job_row = 0;
+}
+
+// Composite up to the given number of rows of the render in progress into
+// bmpdata, which holds MAP_HEIGHT rows of MAP_ROW_WORDS words. Returns 1 once
+// the whole map has been rendered, or the render was abandoned.
+int render_map_continue(uint32_t *bmpdata, int rows) {
+    int y_end = g_job_row + rows;
+
+    if (g_job_row >= MAP_HEIGHT) {
+        return 1;
+    }
+    if (y_end > MAP_HEIGHT) y_end = MAP_HEIGHT;
+
+    composite_rows(bmpdata, g_job_row, y_end);
+    g_job_row = y_end;
+
+    if (g_job_row < MAP_HEIGHT) {
+        return 0;
+    }
+    g_rendered_day = g_job_day;
+    g_rendered_rotation = g_job_rotation;
+    return 1;
+}
+
+// Whether a render_map_start() hasn't been finished yet
+int render_in_progress() {
+    return g_job_row < MAP_HEIGHT;
+}
+
+// Render the whole sunlight overlay for the given day and rotation in one go
+void render_map(uint32_t *bmpdata, int day, int rotation) {
+    render_map_start(day, rotation);
+    render_map_continue(bmpdata, MAP_HEIGHT);
+}
+
+// Switch the pixels of row y that are set in flip between their day and
+// night stipples. Flipping the night state of a pixel flips its output bit
+// exactly where the day and night stipples differ.
+void flip_row(uint32_t *bmpdata, int y, const uint32_t *flip) {
+    const uint32_t *land_stipple = STIPPLE_LAND[y & 3];
+    const uint32_t *water_stipple = STIPPLE_WATER[y & 3];
+    uint32_t land_row[MAP_ROW_WORDS];
+    uint32_t *row = &bmpdata[y * MAP_ROW_WORDS];
+    int i;
+
+    read_land_row(y, land_row);
+    for (i = 0; i < MAP_ROW_WORDS; i++) {
+        uint32_t land = land_row[i];
+        uint32_t diff = (land & (land_stipple[STIPPLE_NIGHT] ^ land_stipple[STIPPLE_DAY])) |
+            (~land & (water_stipple[STIPPLE_NIGHT] ^ water_stipple[STIPPLE_DAY]));
+        row[i] ^= diff & flip[i];
+    }
+}
+
+// Bring a previous render up to date with a new rotation. Only the pixels the
+// terminator swept over since the last render are touched, so moving by a
+// column costs a few hundred pixels rather than a full composite. Returns the
+// number of columns that changed, or -1 if the bitmap holds a different day
+// (or none at all) and needs a full render instead. The twilight bands can't
+// be flipped a single interval per column, so with them on this always asks
+// for a full render.
+int update_map(uint32_t *bmpdata, int day, int rotation) {
+    int x, y, i, changed = 0;
+
+    if (day != g_rendered_day || render_in_progress() || g_twilight) {
+        return -1;
+    }
+    if (rotation == g_rendered_rotation) {
+        return 0;
+    }
+
+    for (x = 0; x < MAP_WIDTH; x++) {
+        int old_h = fold_hour_angle(x + g_rendered_rotation);
+        int new_h = fold_hour_angle(x + rotation);
+
+        int old_row = g_band_row[0][0][old_h], new_row = g_band_row[0][0][new_h];
+        int top_changed = g_band_top[0][old_h] != g_band_top[0][new_h];
+        if (old_row == new_row && !top_changed) {
+            continue;
+        }
+
+        // Rows between the old and new terminator changed state, or if the
+        // top row changed state, all the others did
+        int lo = (old_row < new_row) ? old_row : new_row;
+        int hi = (old_row < new_row) ? new_row : old_row;
+        g_flip_column[changed] = x;
+        g_flip_start[changed] = lo;
+        g_flip_end[changed] = hi;
+        g_flip_outside[changed] = top_changed;
+        changed++;
+    }
+
+    // Flip the changed pixels a row at a time, so each row of the map only
+    // has to be read once
+    for (y = 0; y < MAP_HEIGHT; y++) {
+        uint32_t flip[MAP_ROW_WORDS];
+        int any = 0;
+
+        memset(flip, 0, sizeof(flip));
+        for (i = 0; i < changed; i++) {
+            int inside = y >= g_flip_start[i] && y < g_flip_end[i];
+            if (inside != g_flip_outside[i]) {
+                flip[g_flip_column[i] >> 5] |= (uint32_t)1 << (g_flip_column[i] & 31);
+                any = 1;
+            }
+        }
+        if (any) {
+            flip_row(bmpdata, y, flip);
+        }
+    }
+
+    g_rendered_rotation = rotation;
+    return changed;
+}
+
+// 32 columns of a row of the map from column x on, wrapping around to the
+// start of the row past its right edge. The padding past the right edge is
+// clear, so the columns from the start are ORed in.
+uint32_t map_row_bits(const uint32_t *row, int x) {
+    int word = x >> 5, shift = x & 31;
+    uint32_t bits = row[word] >> shift;
+
+    if (shift && word + 1 < MAP_ROW_WORDS) {
+        bits |= row[word + 1] << (32 - shift);
+    }
+    if (x + 32 > MAP_WIDTH) {
+        bits |= row[0] << (MAP_WIDTH - x);
+    }
+    return bits;
+}
+
+// Copy a row of the map, starting at column x_offset, into a row of
+// row_words words of another bitmap. The map is a whole turn of the globe,
+// so the columns past its right edge wrap around to its left edge.
+void copy_window_row(uint32_t *dest, int row_words, const uint32_t *row, int x_offset) {
+    int i, x = x_offset % MAP_WIDTH;
+
+    if (x < 0) x += MAP_WIDTH;
+    for (i = 0; i < row_words; i++) {
+        dest[i] = map_row_bits(row, x);
+        x += 32;
+        if (x >= MAP_WIDTH) x -= MAP_WIDTH;
+    }
+}
+
+// Render the sunlight overlay for the given day and rotation straight into a
+// window of another bitmap, such as the frame buffer: rows 0..rows-1 of dest,
+// row_words words each, get the map from column x_offset on, wrapping around
+// (see copy_window_row()). No copy of the map is kept, so this composites
+// every row each time.
+void render_map_window(uint32_t *dest, int row_words, int rows, int x_offset,
+        int day, int rotation) {
+    uint32_t row[MAP_ROW_WORDS];
+    int y;
+
+    if (rows > MAP_HEIGHT) rows = MAP_HEIGHT;
+
+    render_map_start(day, rotation);
+    for (y = 0; y < rows; y++) {
+        composite_row(row, y);
+        copy_window_row(&dest[y * row_words], row_words, row, x_offset);
+    }
+    g_job_row = MAP_HEIGHT;
+}
+
+// Render just the map into a window of another bitmap, as above
+void render_bare_map_window(uint32_t *dest, int row_words, int rows, int x_offset) {
+    uint32_t row[MAP_ROW_WORDS];
+    int y, i;
+
+    if (rows > MAP_HEIGHT) rows = MAP_HEIGHT;
+
+    for (y = 0; y < rows; y++) {
+        read_land_row(y, row);
+        for (i = 0; i < MAP_ROW_WORDS; i++) {
+            row[i] = ~row[i];
+        }
+        row[MAP_ROW_WORDS - 1] &= MAP_LAST_WORD_MASK;
+        copy_window_row(&dest[y * row_words], row_words, row, x_offset);
+    }
+}
+
+// Render just the map, without the sunlight overlay
+void render_bare_map(uint32_t *bmpdata) {
+    int y, i;
+    for (y = 0; y < MAP_HEIGHT; y++) {
+        uint32_t *row = &bmpdata[y * MAP_ROW_WORDS];
+        read_land_row(y, row);
+        for (i = 0; i < MAP_ROW_WORDS; i++) {
+            row[i] = ~row[i];
+        }
+    }
+
+    // Anything rendered so far is gone, so the next update_map() has to
+    // render from scratch
+    g_rendered_day = -1;
+    g_job_row = MAP_HEIGHT;
+}
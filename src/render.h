@@ -0,0 +1,61 @@
+// Platform-independent part of the renderer. Nothing here depends on
+// pebble.h, so it also builds as a host library (see tools/Makefile).
+
+#include <stdint.h>
+
+#include "map_config.h"
+
+// The renderer keeps its state in globals. Host tools that render on several
+// threads at once build it with -DRENDER_THREAD_LOCAL, which gives each
+// thread its own copy.
+#ifdef RENDER_THREAD_LOCAL
+#define RENDER_STATE __thread
+#else
+#define RENDER_STATE
+#endif
+
+// Night masks composited into each pixel: the terminator, or with twilight
+// on civil, nautical and astronomical twilight and night. Each starts or
+// stops at most BAND_TOGGLES times down a column. composite_row() is
+// unrolled for four bands.
+#define MAX_BANDS 4
+#define BAND_TOGGLES 2
+
+// Sine of the sun's depression where each band starts, Q15
+extern const int32_t BAND_SIN_DEPRESSION[MAX_BANDS];
+
+// Trig helpers, all Q15 in and out except calc_dp which returns Q30
+void calc_theta(int x_offset, int32_t *cos_theta, int32_t *sin_theta);
+void calc_phi(int y, int32_t *cos_phi, int32_t *sin_phi);
+void calc_dp_terms(int32_t cos_theta, int32_t sin_delta, int32_t cos_delta,
+        int32_t *a, int32_t *b);
+int32_t calc_dp(int32_t cos_phi, int32_t sin_phi, int32_t a, int32_t b);
+
+int calc_rotation(int day, int utc_minutes);
+
+void scan_band_profiles(int day, int bands);
+void update_profile(int day);
+void set_twilight(int enabled);
+
+// The band profiles of a day, saved across launches
+#define PROFILE_BYTES(bands) ((bands) * (1 + BAND_TOGGLES) * (MAP_HALF_WIDTH + 1))
+int save_profile(uint8_t *data, int *bands);
+void restore_profile(int day, int bands, const uint8_t *data);
+void stipple_row(uint32_t *row, int y, const uint32_t night[][MAP_ROW_WORDS], int bands);
+void composite_row(uint32_t *row, int y);
+void composite_rows(uint32_t *bmpdata, int y_start, int y_end);
+void render_bare_map(uint32_t *bmpdata);
+void render_map_start(int day, int rotation);
+int render_map_continue(uint32_t *bmpdata, int rows);
+int render_in_progress();
+void render_map(uint32_t *bmpdata, int day, int rotation);
+void flip_row(uint32_t *bmpdata, int y, const uint32_t *flip);
+int update_map(uint32_t *bmpdata, int day, int rotation);
+
+// Rendering into a window of a bitmap of another size, without keeping a copy
+// of the map. The window can start at any column, and wraps around the map.
+uint32_t map_row_bits(const uint32_t *row, int x);
+void copy_window_row(uint32_t *dest, int row_words, const uint32_t *row, int x_offset);
+void render_map_window(uint32_t *dest, int row_words, int rows, int x_offset,
+        int day, int rotation);
+void render_bare_map_window(uint32_t *dest, int row_words, int rows, int x_offset);
@@ -1,6 +1,9 @@
 #include <pebble.h>
 
+#include "map_config.h"
 #include "pebble_worldmap.h"
+#include "render.h"
+#include "world_clock.h"
 
 /* Globals */
 
@@ -11,39 +14,74 @@ Window *g_window_settings;
 int g_selected_option = 0;
 
 #define OPTION_SHOW_HOME  0
-#define OPTION_TIMEZONE   1
-#define OPTION_LATITUDE   2
-#define OPTION_LONGITUDE  3
-#define LAST_OPTION       OPTION_LONGITUDE
+#define OPTION_TWILIGHT   1
+#define OPTION_TIMEZONE   2
+#define OPTION_LATITUDE   3
+#define OPTION_LONGITUDE  4
+// Then one option per city, to show or hide its clock
+#define OPTION_FIRST_CITY 5
+#define LAST_OPTION       (OPTION_FIRST_CITY + CITY_COUNT - 1)
 
 // Option 1 or 2 is being edited
 int g_edit_option = 0;
 
+// The settings. Edits are made here and only marked dirty; the record is
+// saved under PERSIST_KEY_SETTINGS by flush_settings(), once editing has
+// stopped for SETTINGS_FLUSH_MS or the settings window closes, so holding a
+// button down doesn't write to flash on every repeat.
+Settings g_settings;
+int g_settings_dirty = 0;
+
+// Pending flush, pushed back by each edit
+AppTimer *g_flush_timer = NULL;
+
 // Externs
-extern int g_draw_sunrise;
-extern int g_home_pos[];
-extern int home_latitude;
-extern int home_longitude;
-extern int home_timezone;
-extern const float LATITUDE_TABLE[];
+extern int g_show_perf;
+
+// Bottom of an option on the settings screen, before it is scrolled: the
+// first options take a line for their name and one for the value, and the
+// cities one line each under a heading
+int option_bottom(int option) {
+    if (option < OPTION_FIRST_CITY) {
+        return 20 + 32 * (option + 1);
+    }
+    return 20 + 32 * OPTION_FIRST_CITY + 16 + 16 * (option - OPTION_FIRST_CITY + 1);
+}
+
+// Number of cities shown
+int count_cities() {
+    int i, count = 0;
+    for (i = 0; i < CITY_COUNT; i++) {
+        count += (g_settings.cities >> i) & 1;
+    }
+    return count;
+}
 
 // Render the settings dialog
 void settings_layer_update_callback(Layer *me, GContext* ctx) {
-    char pos_str[16];
+    char pos_str[24];
+    int i;
     GRect rect = {
         .origin = {
             .x = 0,
             .y = 0
         },
         .size = {
-            .w = 144,
+            .w = SCREEN_WIDTH,
             .h = 20
         }
     };
     graphics_context_set_fill_color(ctx, GColorWhite);
-    graphics_fill_rect(ctx, GRect(0, 0, 216, 168), 0, GCornerNone);
+    graphics_fill_rect(ctx, GRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT), 0, GCornerNone);
     graphics_context_set_fill_color(ctx, GColorBlack);
 
+    // The options don't all fit, so scroll up far enough to show the
+    // selected one and the line below it
+    int bottom = option_bottom(g_selected_option) + 16;
+    if (bottom > SCREEN_HEIGHT) {
+        rect.origin.y -= bottom - SCREEN_HEIGHT;
+    }
+
     graphics_context_set_text_color(ctx, GColorBlack);
     graphics_draw_text(
             ctx,
@@ -74,7 +112,34 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
     }
     graphics_draw_text(
             ctx,
-            g_draw_sunrise ? "Enabled" : "Disabled",
+            g_settings.show_home ? "Enabled" : "Disabled",
+            fonts_get_system_font(FONT_KEY_GOTHIC_14),
+            rect,
+            GTextOverflowModeWordWrap,
+            GTextAlignmentLeft,
+            NULL);
+    graphics_context_set_text_color(ctx, GColorBlack);
+
+    rect.origin.y += 16;
+
+    graphics_draw_text(
+            ctx,
+            "Twilight",
+            fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD),
+            rect,
+            GTextOverflowModeWordWrap,
+            GTextAlignmentLeft,
+            NULL);
+
+    rect.origin.y += 16;
+
+    if (g_selected_option == OPTION_TWILIGHT) {
+        graphics_fill_rect(ctx, rect, 0, GCornerNone);
+        graphics_context_set_text_color(ctx, GColorWhite);
+    }
+    graphics_draw_text(
+            ctx,
+            g_settings.twilight ? "Enabled" : "Disabled",
             fonts_get_system_font(FONT_KEY_GOTHIC_14),
             rect,
             GTextOverflowModeWordWrap,
@@ -101,9 +166,9 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
     }
     snprintf(pos_str, 16,
             (g_selected_option == OPTION_TIMEZONE && g_edit_option) ? "> UTC %s %d%s <" : "UTC %s %d%s",
-            (home_timezone >= 0) ? "+" : "-",
-            (home_timezone >= 0) ? (home_timezone/2) : (-home_timezone/2),
-            (home_timezone % 2 != 0) ? ":30" : "");
+            (g_settings.timezone >= 0) ? "+" : "-",
+            (g_settings.timezone >= 0) ? (g_settings.timezone/2) : (-g_settings.timezone/2),
+            (g_settings.timezone % 2 != 0) ? ":30" : "");
     graphics_draw_text(
             ctx,
             pos_str,
@@ -133,8 +198,8 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
     }
     snprintf(pos_str, 12,
             (g_selected_option == OPTION_LATITUDE && g_edit_option) ? "> %d %s <" : "%d %s",
-            (home_latitude >= 0) ? home_latitude : -home_latitude,
-            (home_latitude >= 0) ? "N" : "S");
+            (g_settings.latitude >= 0) ? g_settings.latitude : -g_settings.latitude,
+            (g_settings.latitude >= 0) ? "N" : "S");
     graphics_draw_text(
             ctx,
             pos_str,
@@ -164,8 +229,8 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
     }
     snprintf(pos_str, 12,
             (g_selected_option == OPTION_LONGITUDE && g_edit_option) ? "> %d %s <" : "%d %s",
-            (home_longitude >= 0) ? home_longitude : -home_longitude,
-            (home_longitude >= 0) ? "E" : "W");
+            (g_settings.longitude >= 0) ? g_settings.longitude : -g_settings.longitude,
+            (g_settings.longitude >= 0) ? "E" : "W");
     graphics_draw_text(
             ctx,
             pos_str,
@@ -178,6 +243,38 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
 
     rect.origin.y += 16;
 
+    snprintf(pos_str, sizeof(pos_str), "World clocks (up to %d)", MAX_CITIES);
+    graphics_draw_text(
+            ctx,
+            pos_str,
+            fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD),
+            rect,
+            GTextOverflowModeWordWrap,
+            GTextAlignmentLeft,
+            NULL);
+
+    for (i = 0; i < CITY_COUNT; i++) {
+        rect.origin.y += 16;
+
+        if (g_selected_option == OPTION_FIRST_CITY + i) {
+            graphics_fill_rect(ctx, rect, 0, GCornerNone);
+            graphics_context_set_text_color(ctx, GColorWhite);
+        }
+        snprintf(pos_str, sizeof(pos_str), "%s: %s", CITIES[i].name,
+                ((g_settings.cities >> i) & 1) ? "Shown" : "Hidden");
+        graphics_draw_text(
+                ctx,
+                pos_str,
+                fonts_get_system_font(FONT_KEY_GOTHIC_14),
+                rect,
+                GTextOverflowModeWordWrap,
+                GTextAlignmentLeft,
+                NULL);
+        graphics_context_set_text_color(ctx, GColorBlack);
+    }
+
+    rect.origin.y += 16;
+
     graphics_draw_text(
             ctx,
             "Push <back> to exit",
@@ -188,16 +285,68 @@ void settings_layer_update_callback(Layer *me, GContext* ctx) {
             NULL);
 }
 
-void update_home_pos() {
-    int y;
-    g_home_pos[0] = (home_longitude + 180) * 0.6; // 0-216
-    g_home_pos[1] = 0;
-    for (y = 0; y < 168; y++) {
-        if (LATITUDE_TABLE[y] < home_latitude) {
-            g_home_pos[1] = y;
-            break;
+// Mark the settings as edited, and (re)start the wait before saving them
+void settings_changed() {
+    g_settings_dirty = 1;
+    if (!g_flush_timer || !app_timer_reschedule(g_flush_timer, SETTINGS_FLUSH_MS)) {
+        g_flush_timer = app_timer_register(SETTINGS_FLUSH_MS, handle_timer, (void *)TIMER_ID_FLUSH_SETTINGS);
+    }
+}
+
+// Save the settings if they have been edited
+void flush_settings() {
+    if (g_flush_timer) {
+        // Does nothing if this is called from the timer itself
+        app_timer_cancel(g_flush_timer);
+        g_flush_timer = NULL;
+    }
+    if (g_settings_dirty) {
+        persist_write_data(PERSIST_KEY_SETTINGS, &g_settings, sizeof(g_settings));
+        g_settings_dirty = 0;
+    }
+}
+
+// Read the settings record, making it from the old per-setting keys if it
+// isn't there yet. Returns 0 if there are no settings at all.
+int read_settings() {
+    int length = persist_read_data(PERSIST_KEY_SETTINGS, &g_settings, sizeof(g_settings));
+    if (length > 0 && g_settings.version >= 1 && g_settings.version <= SETTINGS_VERSION) {
+        // An older record is the start of the current one, so the fields
+        // added since are cleared
+        if (g_settings.version < SETTINGS_VERSION) {
+            memset((uint8_t *)&g_settings + length, 0, sizeof(g_settings) - length);
+            g_settings.version = SETTINGS_VERSION;
+            g_settings_dirty = 1;
         }
+        return 1;
     }
+
+    g_settings.version = SETTINGS_VERSION;
+    if (!persist_exists(PERSIST_KEY_SHOW_HOME)) {
+        g_settings.show_home = 1;
+        g_settings.twilight = 0;
+        g_settings.timezone = -16;
+        g_settings.latitude = 37;
+        g_settings.longitude = -122;
+        g_settings.cities = 0;
+        g_settings_dirty = 1;
+        return 0;
+    }
+
+    g_settings.show_home = persist_read_int(PERSIST_KEY_SHOW_HOME);
+    g_settings.twilight = persist_read_int(PERSIST_KEY_TWILIGHT);
+    g_settings.timezone = persist_read_int(PERSIST_KEY_TIMEZONE);
+    g_settings.latitude = persist_read_int(PERSIST_KEY_LATITUDE);
+    g_settings.longitude = persist_read_int(PERSIST_KEY_LONGITUDE);
+    g_settings.cities = 0;
+    g_settings_dirty = 1;
+    flush_settings();
+    persist_delete(PERSIST_KEY_SHOW_HOME);
+    persist_delete(PERSIST_KEY_TWILIGHT);
+    persist_delete(PERSIST_KEY_TIMEZONE);
+    persist_delete(PERSIST_KEY_LATITUDE);
+    persist_delete(PERSIST_KEY_LONGITUDE);
+    return 1;
 }
 
 
@@ -207,25 +356,23 @@ void setting_up_single_click_handler(ClickRecognizerRef recognizer, Window *wind
     (void)window;
     if (g_edit_option) {
         if (g_selected_option == OPTION_TIMEZONE) {
-            home_timezone += 1;
-            if (home_timezone == 25) {
-                home_timezone = -23;
+            g_settings.timezone += 1;
+            if (g_settings.timezone == 25) {
+                g_settings.timezone = -23;
             }
-            persist_write_int(PERSIST_KEY_TIMEZONE, home_timezone);
+            request_refresh();
         } else if (g_selected_option == OPTION_LATITUDE) {
-            if (home_latitude < 90) {
-                home_latitude += 1;
-                persist_write_int(PERSIST_KEY_LATITUDE, home_latitude);
+            if (g_settings.latitude < 90) {
+                g_settings.latitude += 1;
             }
         } else if (g_selected_option == OPTION_LONGITUDE) {
-            home_longitude += 1;
-            if (home_longitude == 180) {
-                home_longitude = -180;
+            g_settings.longitude += 1;
+            if (g_settings.longitude == 180) {
+                g_settings.longitude = -180;
             }
-            persist_write_int(PERSIST_KEY_LONGITUDE, home_longitude);
-            app_timer_register(500, handle_timer, (void *)TIMER_ID_REFRESH);
         }
-        update_home_pos();
+        set_clocks();
+        settings_changed();
     } else {
         if (g_selected_option > 0) {
             g_selected_option--;
@@ -241,25 +388,23 @@ void setting_down_single_click_handler(ClickRecognizerRef recognizer, Window *wi
     (void)window;
     if (g_edit_option) {
         if (g_selected_option == OPTION_TIMEZONE) {
-            home_timezone -= 1;
-            if (home_timezone == -24) {
-                home_timezone = 24;
+            g_settings.timezone -= 1;
+            if (g_settings.timezone == -24) {
+                g_settings.timezone = 24;
             }
-            persist_write_int(PERSIST_KEY_TIMEZONE, home_timezone);
+            request_refresh();
         } else if (g_selected_option == OPTION_LATITUDE) {
-            if (home_latitude > -90) {
-                home_latitude -= 1;
-                persist_write_int(PERSIST_KEY_LATITUDE, home_latitude);
+            if (g_settings.latitude > -90) {
+                g_settings.latitude -= 1;
             }
         } else if (g_selected_option == OPTION_LONGITUDE) {
-            home_longitude -= 1;
-            if (home_longitude == -181) {
-                home_longitude = 179;
+            g_settings.longitude -= 1;
+            if (g_settings.longitude == -181) {
+                g_settings.longitude = 179;
             }
-            persist_write_int(PERSIST_KEY_LONGITUDE, home_longitude);
-            app_timer_register(500, handle_timer, (void *)TIMER_ID_REFRESH);
         }
-        update_home_pos();
+        set_clocks();
+        settings_changed();
     } else {
         if (g_selected_option < LAST_OPTION) {
             g_selected_option++;
@@ -273,23 +418,52 @@ void setting_down_single_click_handler(ClickRecognizerRef recognizer, Window *wi
 void setting_select_single_click_handler(ClickRecognizerRef recognizer, Window *window) {
     if (g_selected_option == OPTION_SHOW_HOME) {
         // Toggle "draw home" setting
-        g_draw_sunrise = 1 - g_draw_sunrise;
-        persist_write_int(PERSIST_KEY_SHOW_HOME, g_draw_sunrise);
+        g_settings.show_home = 1 - g_settings.show_home;
+        set_clocks();
+        settings_changed();
+    } else if (g_selected_option == OPTION_TWILIGHT) {
+        // Toggle the twilight bands, and redraw the map with or without them
+        g_settings.twilight = !g_settings.twilight;
+        set_twilight(g_settings.twilight);
+        settings_changed();
+        request_refresh();
+    } else if (g_selected_option >= OPTION_FIRST_CITY) {
+        // Show or hide a city's clock, as long as there's room for it
+        int bit = 1 << (g_selected_option - OPTION_FIRST_CITY);
+        if ((g_settings.cities & bit) || count_cities() < MAX_CITIES) {
+            g_settings.cities ^= bit;
+            set_clocks();
+            settings_changed();
+        }
     } else {
         g_edit_option = 1 - g_edit_option;
     }
     layer_mark_dirty(window_get_root_layer(g_window_settings));
 }
 
+// Handle a long press of the "select" button: show or hide the timings on the
+// map, which is left out of the options as it's only for development
+void setting_select_long_click_handler(ClickRecognizerRef recognizer, Window *window) {
+    (void)recognizer;
+    (void)window;
+    g_show_perf = !g_show_perf;
+    vibes_short_pulse();
+}
+
 void settings_click_config_provider(void *context) {
     window_single_repeating_click_subscribe(BUTTON_ID_UP, 100, (ClickHandler) setting_up_single_click_handler);
     window_single_repeating_click_subscribe(BUTTON_ID_DOWN, 100, (ClickHandler) setting_down_single_click_handler);
     window_single_click_subscribe(BUTTON_ID_SELECT, (ClickHandler) setting_select_single_click_handler);
+    window_long_click_subscribe(BUTTON_ID_SELECT, 0, (ClickHandler) setting_select_long_click_handler, NULL);
 }
 
-void init_settings() {
-    int show_settings = 0;
+// Save any edits as soon as the settings window closes
+void settings_window_disappear(Window *window) {
+    (void)window;
+    flush_settings();
+}
 
+void init_settings() {
     // The "settings" window
     g_window_settings = window_create();
 
@@ -300,24 +474,20 @@ void init_settings() {
             window_get_root_layer(g_window_settings),
             &settings_layer_update_callback);
 
+    window_set_window_handlers(g_window_settings, (WindowHandlers) {
+        .disappear = settings_window_disappear
+    });
+
     // Read settings
-    if (!persist_exists(PERSIST_KEY_SHOW_HOME)) {
-        show_settings = 1;
-        persist_write_int(PERSIST_KEY_SHOW_HOME, 1);
-        persist_write_int(PERSIST_KEY_LATITUDE, 37);
-        persist_write_int(PERSIST_KEY_LONGITUDE, -122);
-        persist_write_int(PERSIST_KEY_TIMEZONE, -16);
-    }
-    g_draw_sunrise = persist_read_int(PERSIST_KEY_SHOW_HOME);
-    home_latitude = persist_read_int(PERSIST_KEY_LATITUDE);
-    home_longitude = persist_read_int(PERSIST_KEY_LONGITUDE);
-    home_timezone = persist_read_int(PERSIST_KEY_TIMEZONE);
+    int have_settings = read_settings();
+    set_twilight(g_settings.twilight);
 
-    // Calculate "home" position
-    update_home_pos();
+    // Place home and the cities
+    set_clocks();
 
-    // If there are no settings, show settings dialog at startup
-    if (show_settings) {
+    // If there are no settings, show settings dialog at startup (the
+    // defaults are saved when it closes)
+    if (!have_settings) {
         show_settings_window();
     }
 }
@@ -0,0 +1,100 @@
+#include <stdint.h>
+
+#include "ephemeris.h"
+#include "sunrise.h"
+
+// sin(-0.833 degrees) in Q15: the sun's centre is this far below the horizon
+// at sunrise and sunset, once refraction and its radius are allowed for
+#define SIN_HORIZON -476
+
+// Q15 sine, from a 7th order polynomial over a quarter turn. Good to about
+// 2e-4, which is a few seconds of hour angle.
+int32_t sin_q15(int32_t angle) {
+    int32_t z, z2, p, s;
+    int quadrant;
+
+    angle &= SUN_ANGLE_TURN - 1;
+    quadrant = angle >> 14;
+    z = angle & 0x3FFF;
+    if (quadrant & 1) {
+        z = 0x4000 - z;
+    }
+
+    // z is now 0-1 (Q15) of a quarter turn
+    z <<= 1;
+    z2 = (z * z) >> 15;
+    p = 153;
+    p = 2611 - ((z2 * p) >> 15);
+    p = 21167 - ((z2 * p) >> 15);
+    p = 51472 - ((z2 * p) >> 15);
+    s = (z * p) >> 15;
+    if (s > 32767) {
+        s = 32767;
+    }
+
+    return (quadrant & 2) ? -s : s;
+}
+
+int32_t cos_q15(int32_t angle) {
+    return sin_q15(angle + SUN_ANGLE_TURN / 4);
+}
+
+// Sine of the sun's altitude, less that of the horizon, at an hour angle given
+// in quarter-minutes from local noon
+int32_t sun_altitude(int32_t sin_sin, int32_t cos_cos, int quarters) {
+    return sin_sin + ((cos_cos * cos_q15(quarters * 512 / 45)) >> 15) - SIN_HORIZON;
+}
+
+void sun_day(int yday, SunDay *day) {
+    // Declination of the sun
+    day->sin_delta = sin_declination(yday);
+    day->cos_delta = cos_declination(yday);
+    day->equation_of_time = equation_of_time(yday);
+}
+
+int sun_times(int latitude, int longitude, int yday, int timezone,
+        int *sunrise, int *sunset) {
+    SunDay day;
+    sun_day(yday, &day);
+    return sun_times_on(&day, latitude, longitude, timezone, sunrise, sunset);
+}
+
+int sun_times_on(const SunDay *day, int latitude, int longitude, int timezone,
+        int *sunrise, int *sunset) {
+    int32_t sin_phi = sin_q15(latitude * SUN_ANGLE_TURN / 360);
+    int32_t cos_phi = cos_q15(latitude * SUN_ANGLE_TURN / 360);
+
+    int32_t sin_sin = (sin_phi * day->sin_delta) >> 15;
+    int32_t cos_cos = (cos_phi * day->cos_delta) >> 15;
+
+    // The sun's altitude falls from noon to midnight, so the hour angle of
+    // sunset is bracketed by those two and bisected down to a quarter-minute,
+    // which takes 12 steps
+    int lo = 0, hi = 2880;
+    if (sun_altitude(sin_sin, cos_cos, lo) < 0) {
+        return SUN_ALWAYS_DOWN;
+    }
+    if (sun_altitude(sin_sin, cos_cos, hi) >= 0) {
+        return SUN_ALWAYS_UP;
+    }
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (sun_altitude(sin_sin, cos_cos, mid) >= 0) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    if (sun_altitude(sin_sin, cos_cos, lo) < -sun_altitude(sin_sin, cos_cos, hi)) {
+        hi = lo;
+    }
+
+    // Local time of solar noon, in quarter-minutes
+    int noon = 4 * (720 - longitude * 4 + timezone * 30) -
+        day->equation_of_time * 4 / EQUATION_OF_TIME_STEPS;
+
+    // Round to the nearest minute
+    *sunrise = (((noon - hi + 2) >> 2) % 1440 + 1440) % 1440;
+    *sunset = (((noon + hi + 2) >> 2) % 1440 + 1440) % 1440;
+    return SUN_RISES_AND_SETS;
+}
@@ -0,0 +1,41 @@
+// Sunrise/sunset solver: the local times at which the sun's centre is 0.833
+// degrees below the horizon at a location, found by bisecting the hour angle
+// between noon and midnight in fixed point.
+
+#include <stdint.h>
+
+// Angles are in 1/65536ths of a turn, like the Pebble's TRIG_MAX_ANGLE
+#define SUN_ANGLE_TURN 0x10000
+
+// Return values of sun_times()
+#define SUN_RISES_AND_SETS 0
+#define SUN_ALWAYS_UP 1
+#define SUN_ALWAYS_DOWN 2
+
+// Q15 sine and cosine
+int32_t sin_q15(int32_t angle);
+int32_t cos_q15(int32_t angle);
+
+// The sun's terms for a day, which are the same for every location
+typedef struct {
+    int32_t sin_delta;
+    int32_t cos_delta;
+    // Equation of time, in 1/EQUATION_OF_TIME_STEPS minutes
+    int equation_of_time;
+} SunDay;
+
+// Look up the terms for a day of the year (0-365, as in tm_yday)
+void sun_day(int yday, SunDay *day);
+
+// Sunrise and sunset at a given latitude and longitude (whole degrees, North
+// and East positive), day of the year (0-365, as in tm_yday) and time zone (in
+// half-hours relative to UTC). The times are written as minutes after local
+// midnight (0-1439); if the sun doesn't rise or set that day they are left
+// alone and SUN_ALWAYS_UP or SUN_ALWAYS_DOWN is returned.
+int sun_times(int latitude, int longitude, int yday, int timezone,
+        int *sunrise, int *sunset);
+
+// The same, for a day whose terms have already been looked up, so a batch of
+// locations can share them
+int sun_times_on(const SunDay *day, int latitude, int longitude, int timezone,
+        int *sunrise, int *sunset);
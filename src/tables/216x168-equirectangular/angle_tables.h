@@ -0,0 +1,21 @@
+// Angle tables for a 216x168 equirectangular map, with the trig tables as int16. Generated
+// by tools/gen_angle_tables.py, do not edit.
+
+// Trig tables are Q15 fixed-point: 32767 == 1.0. ANGLE_Q15() reads an entry
+// as Q15.
+#define ANGLE_Q15(v) ((int32_t)(v))
+
+// Cosine of each column of hour angle over a quarter turn
+const int16_t THETA_TABLE[] = {32767,32754,32713,32643,32546,32422,32270,32091,31885,31651,31391,31105,30792,30453,30088,29698,29283,28842,28378,27889,27377,26842,26284,25704,25102,24479,23835,23170,22487,21784,21063,20324,19568,18795,18006,17202,16384,15552,14706,13848,12979,12098,11207,10307,9398,8481,7557,6626,5690,4749,3804,2856,1905,953,0};
+
+// Cosine and sine of the latitude of each row from the top to the equator
+const int16_t PHI_COS_TABLE[] = {0,613,1225,1837,2449,3059,3669,4277,4884,5489,6092,6693,7292,7888,8481,9071,9659,10242,10823,11399,11971,12540,13104,13663,14218,14767,15311,15851,16384,16912,17434,17949,18459,18962,19458,19948,20431,20906,21374,21835,22288,22733,23170,23600,24021,24433,24837,25233,25619,25997,26365,26724,27074,27415,27745,28067,28378,28679,28971,29252,29523,29784,30034,30274,30503,30721,30929,31126,31312,31487,31651,31805,31946,32077,32197,32305,32402,32488,32562,32625,32676,32716,32745,32762,32767};
+
+const int16_t PHI_SIN_TABLE[] = {32767,32762,32745,32716,32676,32625,32562,32488,32402,32305,32197,32077,31946,31805,31651,31487,31312,31126,30929,30721,30503,30274,30034,29784,29523,29252,28971,28679,28378,28067,27745,27415,27074,26724,26365,25997,25619,25233,24837,24433,24021,23600,23170,22733,22288,21835,21374,20906,20431,19948,19458,18962,18459,17949,17434,16912,16384,15851,15311,14767,14218,13663,13104,12540,11971,11399,10823,10242,9659,9071,8481,7888,7292,6693,6092,5489,4884,4277,3669,3059,2449,1837,1225,613,0};
+
+// Latitude of each row from the top to the equator, in 1/64 degrees
+const int16_t LATITUDE_TABLE[] = {5760,5691,5623,5554,5486,5417,5349,5280,5211,5143,5074,5006,4937,4869,4800,4731,4663,4594,4526,4457,4389,4320,4251,4183,4114,4046,3977,3909,3840,3771,3703,3634,3566,3497,3429,3360,3291,3223,3154,3086,3017,2949,2880,2811,2743,2674,2606,2537,2469,2400,2331,2263,2194,2126,2057,1989,1920,1851,1783,1714,1646,1577,1509,1440,1371,1303,1234,1166,1097,1029,960,891,823,754,686,617,549,480,411,343,274,206,137,69,0};
+
+// Rows north of the equator of each whole degree of latitude from 0 to 90,
+// in 1/256 rows
+const uint16_t LATITUDE_ROW_TABLE[] = {0,239,478,717,956,1195,1434,1673,1911,2150,2389,2628,2867,3106,3345,3584,3823,4062,4301,4540,4779,5018,5257,5495,5734,5973,6212,6451,6690,6929,7168,7407,7646,7885,8124,8363,8602,8841,9079,9318,9557,9796,10035,10274,10513,10752,10991,11230,11469,11708,11947,12186,12425,12663,12902,13141,13380,13619,13858,14097,14336,14575,14814,15053,15292,15531,15770,16009,16247,16486,16725,16964,17203,17442,17681,17920,18159,18398,18637,18876,19115,19354,19593,19831,20070,20309,20548,20787,21026,21265,21502};
@@ -0,0 +1,51 @@
+// Precomputed day/night terminator for a 216x168 equirectangular map. Generated by
+// tools/gen_terminator_table.py, do not edit.
+
+#define TERMINATOR_BUCKETS 17
+#define TERMINATOR_SIN_MAX 13040
+
+// Packed night rows per declination bucket from bucket 1, see
+// decode_terminator_rows()
+const uint16_t TERMINATOR_OFFSETS[] = {
+0,59,118,177,234,289,344,399,454,509,564,619,674,729,784,839
+};
+const uint8_t TERMINATOR_ROWS[] = {
+167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,1,
+17,34,115,143,243,85,47,246,97,55,34,17,16,16,0,16,0,0,0,0,16,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,16,0,0,1,0,1,1,17,17,33,67,166,127,241,85,63,248,98,106,52,18,17,
+17,16,16,0,16,0,0,1,0,0,0,0,0,16,0,0,0,0,0,0,0,0,165,16,
+0,0,0,0,0,0,0,0,0,0,1,0,0,16,0,16,0,1,1,17,17,18,50,84,
+183,111,248,85,79,241,19,123,69,35,33,17,17,16,16,0,1,0,1,0,0,16,0,0,
+0,0,0,0,0,0,0,0,1,163,0,0,0,0,0,0,0,0,1,0,0,0,1,0,
+16,0,1,1,1,17,17,17,34,51,101,167,253,85,79,213,122,86,51,34,17,17,17,16,
+16,16,0,1,0,16,0,0,0,16,0,0,0,0,0,0,0,0,162,0,0,0,0,0,
+1,0,0,0,0,1,0,16,0,16,16,0,17,16,17,17,34,34,67,101,151,203,189,121,
+86,52,34,34,17,17,1,17,0,1,1,0,1,0,16,0,0,0,0,16,0,0,0,0,
+0,160,0,0,0,0,0,0,0,0,1,0,0,1,0,1,16,16,16,16,17,17,33,33,
+35,68,85,151,169,155,121,85,68,50,18,18,17,17,1,1,1,1,16,0,16,0,0,16,
+0,0,0,0,0,0,0,0,159,0,0,0,0,0,0,1,0,0,16,0,16,0,1,16,
+16,16,17,17,17,33,34,35,68,85,135,136,137,120,85,68,50,34,18,17,17,17,1,1,
+1,16,0,1,0,1,0,0,16,0,0,0,0,0,0,158,0,0,0,16,0,0,0,0,
+1,0,16,0,1,16,16,16,1,17,17,33,33,34,51,68,100,118,119,120,103,70,68,51,
+34,18,18,17,17,16,1,1,1,16,0,1,0,16,0,0,0,0,1,0,0,0,156,0,
+0,0,0,0,0,16,0,0,1,0,1,16,16,16,16,17,17,17,33,33,50,50,68,84,
+102,103,119,102,69,68,35,35,18,18,17,17,17,1,1,1,1,16,0,16,0,0,1,0,
+0,0,0,0,0,155,0,0,0,0,16,0,0,0,1,0,1,16,16,16,16,16,17,17,
+17,18,34,50,50,68,84,101,101,87,86,69,68,35,35,34,33,17,17,17,1,1,1,1,
+1,16,0,16,0,0,0,1,0,0,0,0,154,0,0,16,0,0,0,16,0,0,1,16,
+16,0,17,16,16,17,17,33,33,34,34,51,67,84,85,85,86,85,69,52,51,34,34,18,
+18,17,17,1,1,17,0,1,1,16,0,0,1,0,0,0,1,0,0,152,0,0,0,0,
+0,1,0,16,0,16,0,1,1,1,17,16,17,17,18,18,34,50,51,51,68,85,69,85,
+85,68,51,51,35,34,33,33,17,17,1,17,16,16,16,0,1,0,1,0,16,0,0,0,
+0,0,151,0,0,0,16,0,0,16,0,16,0,1,16,16,1,17,16,17,33,17,34,33,
+35,51,51,68,68,69,85,68,68,51,51,50,18,34,17,18,17,1,17,16,1,1,16,0,
+1,0,1,0,0,1,0,0,0,149,0,0,0,0,0,16,0,16,0,1,16,16,16,16,
+17,16,17,33,17,34,34,34,51,51,52,68,68,69,68,67,51,51,34,34,34,17,18,17,
+1,17,1,1,1,1,16,0,1,0,1,0,0,0,0,0,148,0,0,0,0,1,0,16,
+0,16,0,1,1,17,16,1,17,17,33,33,33,34,34,51,51,51,68,52,68,68,51,51,
+51,34,34,18,18,18,17,17,16,1,17,16,16,0,1,0,1,0,16,0,0,0,0,147,
+0,16,0,0,0,16,0,16,0,1,1,1,1,17,16,17,17,33,33,33,34,34,35,51,
+67,51,52,68,51,52,51,50,34,34,18,18,18,17,17,1,17,16,16,16,16,0,1,0,
+1,0,0,0,1,0
+};
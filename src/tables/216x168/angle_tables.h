@@ -0,0 +1,21 @@
+// Angle tables for a 216x168 mercator map, with the trig tables as int16. Generated
+// by tools/gen_angle_tables.py, do not edit.
+
+// Trig tables are Q15 fixed-point: 32767 == 1.0. ANGLE_Q15() reads an entry
+// as Q15.
+#define ANGLE_Q15(v) ((int32_t)(v))
+
+// Cosine of each column of hour angle over a quarter turn
+const int16_t THETA_TABLE[] = {32767,32754,32713,32643,32546,32422,32270,32091,31885,31651,31391,31105,30792,30453,30088,29698,29283,28842,28378,27889,27377,26842,26284,25704,25102,24479,23835,23170,22487,21784,21063,20324,19568,18795,18006,17202,16384,15552,14706,13848,12979,12098,11207,10307,9398,8481,7557,6626,5690,4749,3804,2856,1905,953,0};
+
+// Cosine and sine of the latitude of each row from the top to the equator
+const int16_t PHI_COS_TABLE[] = {5650,5814,5983,6156,6335,6518,6706,6900,7099,7303,7513,7728,7950,8177,8411,8650,8896,9148,9407,9673,9945,10224,10510,10803,11103,11411,11726,12048,12377,12715,13059,13411,13771,14138,14513,14895,15285,15682,16086,16497,16915,17340,17771,18209,18652,19101,19555,20013,20476,20943,21413,21886,22361,22837,23313,23789,24265,24738,25208,25675,26136,26591,27040,27479,27910,28330,28738,29133,29513,29878,30227,30557,30868,31159,31429,31676,31900,32100,32275,32424,32547,32644,32713,32754,32767};
+
+const int16_t PHI_SIN_TABLE[] = {32277,32248,32217,32185,32150,32113,32074,32033,31990,31944,31895,31844,31789,31731,31670,31606,31537,31465,31389,31308,31222,31132,31037,30936,30829,30717,30598,30473,30340,30201,30053,29898,29734,29561,29379,29187,28985,28772,28548,28312,28064,27804,27530,27243,26942,26625,26294,25946,25582,25202,24804,24387,23953,23500,23027,22535,22022,21489,20935,20361,19765,19148,18510,17850,17169,16467,15744,15001,14237,13455,12653,11833,10995,10141,9272,8388,7491,6582,5662,4733,3796,2852,1904,953,0};
+
+// Latitude of each row from the top to the equator, in 1/64 degrees
+const int16_t LATITUDE_TABLE[] = {5125,5106,5087,5067,5047,5026,5004,4982,4959,4936,4912,4887,4861,4835,4808,4780,4752,4722,4692,4661,4629,4596,4563,4528,4492,4456,4418,4379,4340,4299,4257,4214,4170,4124,4077,4030,3980,3930,3878,3825,3771,3715,3658,3600,3540,3478,3415,3351,3285,3217,3149,3078,3006,2932,2857,2781,2702,2623,2541,2459,2374,2288,2201,2112,2022,1931,1838,1744,1648,1552,1454,1355,1255,1154,1052,949,846,742,637,531,426,320,213,107,0};
+
+// Rows north of the equator of each whole degree of latitude from 0 to 90,
+// in 1/256 rows
+const uint16_t LATITUDE_ROW_TABLE[] = {0,154,307,461,615,769,923,1078,1233,1388,1544,1700,1857,2014,2172,2331,2490,2650,2811,2973,3136,3300,3465,3632,3799,3968,4138,4310,4483,4658,4834,5013,5193,5375,5559,5745,5934,6125,6319,6515,6714,6916,7121,7330,7541,7757,7976,8199,8426,8658,8895,9136,9383,9635,9893,10158,10429,10708,10993,11287,11590,11902,12224,12557,12901,13258,13628,14013,14415,14834,15273,15733,16217,16728,17269,17844,18458,19116,19826,20597,21441,22372,23412,24591,25950,27557,29523,32057,35626,41727,65535};
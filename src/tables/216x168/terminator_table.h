@@ -0,0 +1,50 @@
+// Precomputed day/night terminator for a 216x168 mercator map. Generated by
+// tools/gen_terminator_table.py, do not edit.
+
+#define TERMINATOR_BUCKETS 17
+#define TERMINATOR_SIN_MAX 13040
+
+// Packed night rows per declination bucket from bucket 1, see
+// decode_terminator_rows()
+const uint16_t TERMINATOR_OFFSETS[] = {
+0,59,118,173,228,283,338,393,448,503,558,613,668,723,778,833
+};
+const uint8_t TERMINATOR_ROWS[] = {
+169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,112,218,127,247,85,63,242,225,173,7,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,68,84,118,185,111,248,85,79,241,35,155,103,69,68,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,50,51,67,84,102,
+168,219,190,138,102,69,52,51,35,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,33,
+34,34,50,50,52,69,101,135,154,170,120,86,84,67,35,35,34,34,18,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,0,0,0,0,0,0,
+0,0,17,17,33,17,34,33,34,35,51,51,84,85,118,120,136,103,85,69,51,51,50,34,
+18,34,17,18,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,
+0,0,0,0,0,17,16,1,17,17,17,18,33,33,33,34,35,35,52,68,84,102,102,103,
+102,69,68,67,50,50,34,18,18,18,33,17,17,17,16,1,17,0,0,0,0,0,0,0,
+0,0,168,0,0,0,1,0,1,16,16,16,16,1,17,17,16,18,17,33,33,18,34,35,
+50,51,68,68,85,86,102,85,68,68,51,35,50,34,33,18,18,17,33,1,17,17,16,1,
+1,1,1,16,0,16,0,0,0,163,0,0,0,0,1,16,0,1,1,17,16,1,17,17,
+17,33,17,18,34,34,34,50,51,67,68,84,69,85,69,68,52,51,35,34,34,34,33,17,
+18,17,17,17,16,1,17,16,16,0,1,16,0,0,0,0,159,0,0,0,16,0,16,16,
+0,1,17,16,17,16,17,17,33,17,18,34,33,50,50,50,67,67,68,68,69,68,52,52,
+35,35,35,18,34,33,17,18,17,17,1,17,1,17,16,0,1,1,0,1,0,0,0,156,
+0,1,0,0,1,0,1,1,1,1,17,16,17,17,17,17,33,33,33,34,34,34,51,51,
+51,68,52,68,68,51,51,51,34,34,34,18,18,18,17,17,17,17,1,17,16,16,16,16,
+0,16,0,0,16,0,152,0,0,0,16,0,16,16,0,17,16,16,1,17,17,17,17,18,
+33,33,34,49,34,50,51,51,67,51,52,52,51,51,35,34,19,34,18,18,33,17,17,17,
+17,16,1,1,17,0,1,1,0,1,0,0,0,149,0,0,0,1,0,1,16,16,16,16,
+16,17,16,17,17,17,18,33,33,33,34,34,35,35,51,51,51,52,51,51,50,50,34,34,
+18,18,18,33,17,17,17,1,17,1,1,1,1,1,16,0,16,0,0,0,146,0,0,0,
+16,0,16,16,0,1,17,16,1,17,17,17,17,17,18,18,18,34,34,50,50,50,51,35,
+51,51,35,35,35,34,34,33,33,33,17,17,17,17,17,16,1,17,16,0,1,1,0,1,
+0,0,0,144,1,0,0,0,1,0,1,1,1,1,1,17,17,16,17,17,18,17,18,34,
+33,34,34,35,50,35,35,51,50,35,50,34,34,18,34,33,17,33,17,17,1,17,17,16,
+16,16,16,16,0,16,0,0,0,16,141,0,0,16,0,0,1,16,16,16,16,16,1,17,
+17,17,17,17,33,17,34,33,34,34,34,50,50,34,35,35,35,34,34,34,18,34,17,18,
+17,17,17,17,17,16,1,1,1,1,1,16,0,0,1,0,0,139,0,1,0,0,1,0,
+1,1,16,16,1,17,16,17,17,17,17,33,17,18,34,33,34,34,34,35,34,35,50,34,
+34,34,18,34,33,17,18,17,17,17,17,1,17,16,1,1,16,16,0,16,0,0,16,0
+};
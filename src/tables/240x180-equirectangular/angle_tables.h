@@ -0,0 +1,21 @@
+// Angle tables for a 240x180 equirectangular map, with the trig tables as int16. Generated
+// by tools/gen_angle_tables.py, do not edit.
+
+// Trig tables are Q15 fixed-point: 32767 == 1.0. ANGLE_Q15() reads an entry
+// as Q15.
+#define ANGLE_Q15(v) ((int32_t)(v))
+
+// Cosine of each column of hour angle over a quarter turn
+const int16_t THETA_TABLE[] = {32767,32757,32723,32667,32588,32488,32365,32219,32052,31863,31651,31419,31164,30888,30592,30274,29935,29576,29197,28797,28378,27939,27482,27005,26510,25997,25466,24917,24351,23769,23170,22556,21926,21281,20622,19948,19261,18560,17847,17121,16384,15636,14876,14107,13328,12540,11743,10938,10126,9307,8481,7650,6813,5971,5126,4277,3425,2571,1715,858,0};
+
+// Cosine and sine of the latitude of each row from the top to the equator
+const int16_t PHI_COS_TABLE[] = {0,572,1144,1715,2286,2856,3425,3993,4560,5126,5690,6252,6813,7371,7927,8481,9032,9580,10126,10668,11207,11743,12275,12803,13328,13848,14365,14876,15384,15886,16384,16877,17364,17847,18324,18795,19261,19720,20174,20622,21063,21498,21926,22348,22763,23170,23571,23965,24351,24730,25102,25466,25822,26170,26510,26842,27166,27482,27789,28088,28378,28660,28932,29197,29452,29698,29935,30163,30382,30592,30792,30983,31164,31336,31499,31651,31795,31928,32052,32166,32270,32365,32449,32524,32588,32643,32688,32723,32748,32763,32767};
+
+const int16_t PHI_SIN_TABLE[] = {32767,32763,32748,32723,32688,32643,32588,32524,32449,32365,32270,32166,32052,31928,31795,31651,31499,31336,31164,30983,30792,30592,30382,30163,29935,29698,29452,29197,28932,28660,28378,28088,27789,27482,27166,26842,26510,26170,25822,25466,25102,24730,24351,23965,23571,23170,22763,22348,21926,21498,21063,20622,20174,19720,19261,18795,18324,17847,17364,16877,16384,15886,15384,14876,14365,13848,13328,12803,12275,11743,11207,10668,10126,9580,9032,8481,7927,7371,6813,6252,5690,5126,4560,3993,3425,2856,2286,1715,1144,572,0};
+
+// Latitude of each row from the top to the equator, in 1/64 degrees
+const int16_t LATITUDE_TABLE[] = {5760,5696,5632,5568,5504,5440,5376,5312,5248,5184,5120,5056,4992,4928,4864,4800,4736,4672,4608,4544,4480,4416,4352,4288,4224,4160,4096,4032,3968,3904,3840,3776,3712,3648,3584,3520,3456,3392,3328,3264,3200,3136,3072,3008,2944,2880,2816,2752,2688,2624,2560,2496,2432,2368,2304,2240,2176,2112,2048,1984,1920,1856,1792,1728,1664,1600,1536,1472,1408,1344,1280,1216,1152,1088,1024,960,896,832,768,704,640,576,512,448,384,320,256,192,128,64,0};
+
+// Rows north of the equator of each whole degree of latitude from 0 to 90,
+// in 1/256 rows
+const uint16_t LATITUDE_ROW_TABLE[] = {0,256,512,768,1024,1280,1536,1792,2048,2304,2560,2816,3072,3328,3584,3840,4096,4352,4608,4864,5120,5376,5632,5888,6144,6400,6656,6912,7168,7424,7680,7936,8192,8448,8704,8960,9216,9472,9728,9984,10240,10496,10752,11008,11264,11520,11776,12032,12288,12544,12800,13056,13312,13568,13824,14080,14336,14592,14848,15104,15360,15616,15872,16128,16384,16640,16896,17152,17408,17664,17920,18176,18432,18688,18944,19200,19456,19712,19968,20224,20480,20736,20992,21248,21504,21760,22016,22272,22528,22784,23037};
@@ -0,0 +1,55 @@
+// Precomputed day/night terminator for a 240x180 equirectangular map. Generated by
+// tools/gen_terminator_table.py, do not edit.
+
+#define TERMINATOR_BUCKETS 17
+#define TERMINATOR_SIN_MAX 13040
+
+// Packed night rows per declination bucket from bucket 1, see
+// decode_terminator_rows()
+const uint16_t TERMINATOR_OFFSETS[] = {
+0,65,130,195,257,318,379,440,501,562,623,684,745,806,867,928
+};
+const uint8_t TERMINATOR_ROWS[] = {
+179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,16,0,0,
+1,1,1,33,49,132,143,249,181,47,252,161,72,19,18,16,16,16,0,0,1,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,16,0,0,0,1,0,16,0,1,17,16,18,34,83,183,127,
+246,181,63,255,194,123,53,34,33,1,17,16,0,1,0,16,0,0,0,1,0,0,0,0,
+0,0,0,16,0,0,0,0,0,0,176,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,16,0,0,1,0,1,16,16,1,17,33,33,51,100,200,111,254,181,79,247,131,140,70,
+51,18,18,17,16,1,1,16,0,16,0,0,1,0,0,0,16,0,0,0,0,0,0,0,
+0,0,0,175,0,0,0,0,0,16,0,0,0,0,0,16,0,0,16,0,16,0,1,16,
+16,1,17,17,34,34,67,101,184,237,79,220,139,86,52,34,34,17,17,16,1,1,16,0,
+1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,173,0,0,0,0,0,0,
+0,0,16,0,0,0,16,0,16,0,16,16,0,17,16,17,17,33,33,51,67,117,167,187,
+188,122,87,52,51,18,18,17,17,1,17,0,1,1,0,1,0,1,0,0,0,1,0,0,
+0,0,0,0,0,0,172,0,0,0,0,0,16,0,0,0,0,1,0,0,1,16,0,1,
+16,16,1,17,17,17,34,49,50,68,102,135,154,170,120,102,68,35,19,34,17,17,17,16,
+1,1,16,0,1,16,0,0,16,0,0,0,0,1,0,0,0,0,0,170,0,0,0,0,
+0,0,0,0,1,0,0,1,0,1,16,0,1,1,1,17,17,17,33,33,50,51,68,101,
+119,136,137,119,86,68,51,35,18,18,17,17,17,16,16,16,0,1,16,0,16,0,0,16,
+0,0,0,0,0,0,0,0,169,0,0,0,0,0,16,0,0,0,1,0,16,0,16,16,
+0,1,17,16,17,17,17,33,34,50,51,68,85,118,119,120,103,85,68,51,35,34,18,17,
+17,17,1,17,16,0,1,1,0,1,0,16,0,0,0,1,0,0,0,0,0,168,0,16,
+0,0,0,0,0,16,0,0,1,0,1,16,0,1,17,16,1,17,17,18,33,34,50,51,
+68,85,102,102,103,102,85,68,51,35,34,18,33,17,17,16,1,17,16,0,1,16,0,16,
+0,0,1,0,0,0,0,0,1,0,166,0,0,0,0,0,16,0,0,16,0,16,0,16,
+16,0,1,17,16,17,17,17,33,33,34,35,67,67,69,86,86,102,101,84,52,52,50,34,
+18,18,17,17,17,1,17,16,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,165,
+0,0,1,0,0,0,0,1,0,16,0,1,16,0,1,17,16,1,17,17,33,17,34,34,
+35,51,68,68,85,85,86,85,68,68,51,50,34,34,17,18,17,17,16,1,17,16,0,1,
+16,0,1,0,16,0,0,0,0,16,0,0,163,0,0,0,0,0,1,0,0,1,0,1,
+16,0,1,1,17,16,17,16,33,17,33,34,34,50,51,67,68,84,69,85,69,68,52,51,
+35,34,34,18,17,18,1,17,1,17,16,16,0,1,16,0,16,0,0,16,0,0,0,0,
+0,162,0,0,1,0,0,0,16,0,0,1,16,0,1,1,1,17,16,17,17,17,17,34,
+33,34,35,51,67,52,69,68,69,84,67,52,51,50,34,18,34,17,17,17,17,1,17,16,
+16,16,0,1,16,0,0,1,0,0,0,16,0,0,160,0,0,0,0,16,0,0,16,0,
+16,0,1,1,1,1,17,16,17,17,17,33,33,34,34,50,50,67,67,52,68,69,67,52,
+52,35,35,34,34,18,18,17,17,17,1,17,16,16,16,16,0,1,0,1,0,0,1,0,
+0,0,0,159,0,16,0,0,0,0,1,0,1,0,1,1,16,16,1,17,16,17,17,17,
+18,18,34,34,50,50,51,52,67,52,68,52,67,51,35,35,34,34,33,33,17,17,17,1,
+17,16,1,1,16,16,0,16,0,16,0,0,0,0,1,0,157,0,0,0,0,1,0,0,
+1,0,1,16,16,16,16,16,1,17,17,17,17,18,18,34,34,50,50,51,51,67,51,52,
+52,51,51,35,35,34,34,33,33,17,17,17,17,16,1,1,1,1,1,16,0,16,0,0,
+16,0,0,0,0
+};
@@ -0,0 +1,21 @@
+// Angle tables for a 240x180 mercator map, with the trig tables as int16. Generated
+// by tools/gen_angle_tables.py, do not edit.
+
+// Trig tables are Q15 fixed-point: 32767 == 1.0. ANGLE_Q15() reads an entry
+// as Q15.
+#define ANGLE_Q15(v) ((int32_t)(v))
+
+// Cosine of each column of hour angle over a quarter turn
+const int16_t THETA_TABLE[] = {32767,32757,32723,32667,32588,32488,32365,32219,32052,31863,31651,31419,31164,30888,30592,30274,29935,29576,29197,28797,28378,27939,27482,27005,26510,25997,25466,24917,24351,23769,23170,22556,21926,21281,20622,19948,19261,18560,17847,17121,16384,15636,14876,14107,13328,12540,11743,10938,10126,9307,8481,7650,6813,5971,5126,4277,3425,2571,1715,858,0};
+
+// Cosine and sine of the latitude of each row from the top to the equator
+const int16_t PHI_COS_TABLE[] = {6156,6316,6481,6649,6822,6999,7180,7365,7556,7750,7950,8154,8363,8578,8797,9021,9251,9486,9726,9972,10224,10481,10744,11012,11287,11567,11854,12146,12444,12749,13059,13376,13699,14027,14362,14703,15050,15403,15762,16127,16497,16873,17255,17641,18033,18429,18831,19236,19646,20059,20476,20896,21319,21744,22171,22599,23027,23456,23885,24312,24738,25161,25582,25998,26410,26816,27217,27610,27995,28371,28738,29094,29438,29771,30089,30394,30684,30958,31215,31455,31676,31879,32062,32225,32368,32489,32589,32667,32723,32757,32767};
+
+const int16_t PHI_SIN_TABLE[] = {32185,32153,32121,32086,32050,32012,31972,31930,31885,31838,31789,31737,31683,31625,31565,31502,31435,31365,31291,31214,31132,31047,30957,30862,30763,30658,30549,30434,30313,30186,30053,29914,29767,29614,29453,29284,29107,28922,28728,28525,28312,28090,27857,27614,27360,27094,26817,26528,26226,25911,25582,25241,24885,24514,24129,23729,23313,22881,22434,21970,21489,20992,20477,19946,19397,18831,18248,17648,17030,16396,15744,15076,14392,13691,12976,12245,11500,10741,9969,9184,8388,7581,6764,5939,5105,4265,3419,2568,1714,858,0};
+
+// Latitude of each row from the top to the equator, in 1/64 degrees
+const int16_t LATITUDE_TABLE[] = {5067,5049,5030,5011,4991,4971,4950,4929,4907,4884,4861,4838,4814,4789,4763,4737,4710,4683,4655,4626,4596,4566,4535,4503,4471,4437,4403,4368,4332,4295,4257,4218,4178,4138,4096,4054,4010,3966,3920,3873,3825,3776,3726,3675,3623,3570,3515,3459,3402,3344,3285,3224,3162,3099,3035,2969,2903,2835,2765,2695,2623,2550,2475,2400,2323,2245,2166,2086,2004,1922,1838,1753,1667,1581,1493,1404,1315,1225,1134,1042,949,856,762,668,574,479,383,288,192,96,0};
+
+// Rows north of the equator of each whole degree of latitude from 0 to 90,
+// in 1/256 rows
+const uint16_t LATITUDE_ROW_TABLE[] = {0,171,341,512,683,854,1026,1198,1370,1542,1715,1889,2063,2238,2413,2590,2767,2945,3124,3304,3485,3667,3850,4035,4221,4409,4598,4789,4981,5175,5371,5569,5770,5972,6177,6384,6593,6806,7021,7239,7460,7685,7912,8144,8379,8618,8862,9110,9363,9620,9883,10151,10425,10706,10993,11287,11588,11897,12215,12542,12878,13224,13582,13952,14334,14731,15142,15571,16017,16482,16970,17481,18019,18587,19188,19827,20509,21240,22029,22886,23823,24858,26014,27323,28834,30619,32804,35618,39585,46363,65535};
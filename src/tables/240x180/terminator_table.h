@@ -0,0 +1,55 @@
+// Precomputed day/night terminator for a 240x180 mercator map. Generated by
+// tools/gen_terminator_table.py, do not edit.
+
+#define TERMINATOR_BUCKETS 17
+#define TERMINATOR_SIN_MAX 13040
+
+// Packed night rows per declination bucket from bucket 1, see
+// decode_terminator_rows()
+const uint16_t TERMINATOR_OFFSETS[] = {
+0,67,132,193,254,315,376,437,498,559,620,681,742,803,864,925
+};
+const uint8_t TERMINATOR_ROWS[] = {
+181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,144,250,57,127,254,181,63,247,34,31,163,9,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,68,85,135,
+201,111,254,181,79,247,115,156,120,85,68,1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,49,50,67,68,85,118,169,219,190,154,103,85,68,
+52,35,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,34,34,
+50,50,51,68,100,117,135,154,170,120,87,70,68,51,35,35,34,34,17,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,17,33,17,34,33,34,50,50,51,68,84,101,118,120,136,103,86,
+69,68,51,35,35,34,18,34,17,18,17,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,0,16,17,17,17,17,17,18,18,
+34,34,34,51,66,67,68,85,117,102,103,87,85,68,52,36,51,34,34,34,33,33,17,17,
+17,17,17,1,0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,0,0,0,0,0,
+1,16,16,1,1,17,17,1,33,17,17,18,18,34,34,34,50,51,51,68,84,85,86,102,
+85,69,68,51,51,35,34,34,34,33,33,17,17,18,16,17,17,16,16,1,1,16,0,0,
+0,0,0,0,0,178,0,0,0,16,0,16,0,1,1,1,1,17,16,17,17,17,17,17,
+18,18,34,33,50,34,51,51,52,84,84,69,85,69,69,67,51,51,34,35,18,34,33,33,
+17,17,17,17,17,1,17,16,16,16,16,0,1,0,1,0,0,0,174,0,16,0,0,16,
+0,1,16,16,16,16,16,17,16,17,17,17,33,17,18,34,18,50,34,51,50,52,68,68,
+68,69,68,68,67,35,51,34,35,33,34,33,17,18,17,17,17,1,17,1,1,1,1,1,
+16,0,1,0,0,1,0,170,16,0,0,0,1,0,1,16,16,16,16,1,17,1,17,17,
+17,33,17,18,34,33,34,50,50,50,51,52,68,52,68,68,67,51,35,35,35,34,18,34,
+33,17,18,17,17,17,16,17,16,1,1,1,1,16,0,16,0,0,0,1,166,0,0,1,
+0,16,0,16,16,0,17,16,16,1,17,17,17,17,17,18,33,33,18,34,50,34,51,50,
+52,67,51,52,52,67,35,51,34,35,34,33,18,18,33,17,17,17,17,17,16,1,1,17,
+0,1,1,0,1,0,16,0,0,162,0,0,0,16,0,16,0,1,16,16,16,1,17,1,
+17,17,17,17,18,33,33,18,34,34,50,50,50,51,51,51,52,51,51,35,35,35,34,34,
+33,18,18,33,17,17,17,17,16,17,16,1,1,1,16,0,1,0,1,0,0,0,159,0,
+0,0,1,0,16,0,1,1,1,1,17,16,1,17,17,17,17,18,33,33,33,34,33,35,
+34,51,50,51,35,51,51,35,51,34,50,18,34,18,18,18,33,17,17,17,17,16,1,17,
+16,16,16,16,0,1,0,16,0,0,0,156,0,0,0,1,0,16,0,1,1,1,1,1,
+17,1,17,17,17,17,33,17,18,18,34,34,34,34,50,50,50,35,51,35,35,35,34,34,
+34,34,33,33,17,18,17,17,17,17,16,17,16,16,16,16,16,0,1,0,16,0,0,0,
+153,0,0,0,16,0,16,0,1,16,16,16,1,17,16,17,17,32,17,17,33,17,34,33,
+18,34,50,34,50,50,34,35,35,35,34,35,34,33,18,34,17,18,17,17,2,17,17,1,
+17,16,1,1,1,16,0,1,0,1,0,0,0,151,0,1,0,0,16,0,16,16,0,1,
+17,16,16,17,16,17,17,17,17,18,33,33,33,33,34,34,34,34,35,34,35,50,34,34,
+34,34,18,18,18,18,33,17,17,17,17,1,17,1,1,17,16,0,1,1,0,1,0,0,
+16,0
+};
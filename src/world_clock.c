@@ -0,0 +1,81 @@
+#include <stdint.h>
+
+#include "projection.h"
+#include "sunrise.h"
+#include "world_clock.h"
+
+// Days in the ephemeris, see ephemeris_table.h
+#define DAYS 366
+
+const City CITIES[CITY_COUNT] = {
+    {"LON", "London", 52, 0, 0},
+    {"PAR", "Paris", 49, 2, 2},
+    {"MOW", "Moscow", 56, 38, 6},
+    {"CAI", "Cairo", 30, 31, 4},
+    {"DXB", "Dubai", 25, 55, 8},
+    {"DEL", "Delhi", 29, 77, 11},
+    {"HKG", "Hong Kong", 22, 114, 16},
+    {"TYO", "Tokyo", 36, 140, 18},
+    {"SYD", "Sydney", -34, 151, 20},
+    {"SAO", "Sao Paulo", -24, -47, -6},
+    {"NYC", "New York", 41, -74, -10},
+    {"SFO", "San Francisco", 38, -122, -16}
+};
+
+void set_clock(Clock *clock, int latitude, int longitude, int timezone) {
+    int y = projection_y(latitude * PROJECTION_DEGREE);
+
+    clock->latitude = latitude;
+    clock->longitude = longitude;
+    clock->timezone = timezone;
+    clock->x = projection_x(longitude * PROJECTION_DEGREE);
+    clock->y = (y < 0) ? 0 : (y >= MAP_HEIGHT) ? MAP_HEIGHT - 1 : y;
+    clock->rise[0] = clock->rise[1] = 0;
+    clock->set[0] = clock->set[1] = 0;
+    clock->solved_day = -1;
+}
+
+void update_clocks(Clock *clocks, int count, int utc_day, int utc_minutes) {
+    // Local days are at most a day either side of UTC, and each clock also
+    // wants the day after its own. They're looked up the first time a clock
+    // needs solving.
+    SunDay days[4];
+    int looked_up = 0;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        Clock *clock = &clocks[i];
+        int minutes = utc_minutes + clock->timezone * 30;
+        int shift = (minutes < 0) ? -1 : (minutes >= 1440) ? 1 : 0;
+        int day = (utc_day + shift + DAYS) % DAYS;
+
+        clock->minutes = minutes - shift * 1440;
+        if (day != clock->solved_day) {
+            if (!looked_up) {
+                int j;
+                for (j = 0; j < 4; j++) {
+                    sun_day((utc_day - 1 + j + DAYS) % DAYS, &days[j]);
+                }
+                looked_up = 1;
+            }
+            clock->sun = sun_times_on(&days[shift + 1], clock->latitude, clock->longitude,
+                    clock->timezone, &clock->rise[0], &clock->set[0]);
+            sun_times_on(&days[shift + 2], clock->latitude, clock->longitude,
+                    clock->timezone, &clock->rise[1], &clock->set[1]);
+            clock->solved_day = day;
+        }
+
+        if (clock->sun == SUN_RISES_AND_SETS) {
+            int rise = clock->rise[0], set = clock->set[0];
+            clock->sunrise = (clock->minutes >= rise) ? clock->rise[1] : rise;
+            clock->sunset = (clock->minutes >= set) ? clock->set[1] : set;
+            // A time zone far from the longitude can put sunset before
+            // sunrise on the clock
+            clock->is_day = (rise <= set) ?
+                (clock->minutes >= rise && clock->minutes < set) :
+                (clock->minutes >= rise || clock->minutes < set);
+        } else {
+            clock->is_day = clock->sun == SUN_ALWAYS_UP;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// World clocks: the local time, the next sunrise and sunset, and whether it's
+// day, at home and at a few cities. A clock's sunrise and sunset are only
+// solved again when its local day changes, from the sun's terms for the days
+// around UTC's, which the clocks share.
+
+#include <stdint.h>
+
+// Cities that can be shown, and how many at once
+#define CITY_COUNT 12
+#define MAX_CITIES 3
+
+// Home and the cities
+#define MAX_CLOCKS (1 + MAX_CITIES)
+
+typedef struct {
+    // Short name, for the one-line summary
+    const char *code;
+    const char *name;
+    int8_t latitude;
+    int16_t longitude;
+    // Standard time, in half-hours relative to UTC; summer time isn't applied
+    int8_t timezone;
+} City;
+
+extern const City CITIES[CITY_COUNT];
+
+typedef struct {
+    // Label for the clock, left to the caller
+    const char *code;
+
+    // Where it is, in whole degrees, and its time zone in half-hours
+    int latitude;
+    int longitude;
+    int timezone;
+
+    // Position on the map, see projection.h
+    int x;
+    int y;
+
+    // Local time, in minutes after midnight
+    int minutes;
+
+    // SUN_RISES_AND_SETS, SUN_ALWAYS_UP or SUN_ALWAYS_DOWN for the local day,
+    // and if the sun rises and sets, the next sunrise and sunset in minutes
+    // after local midnight: today's until it has passed, then tomorrow's
+    int sun;
+    int sunrise;
+    int sunset;
+    int is_day;
+
+    // Local day the sun was last solved for, and the times for that day and
+    // the next
+    int solved_day;
+    int rise[2];
+    int set[2];
+} Clock;
+
+// Set up a clock for a location; its times are filled in by update_clocks()
+void set_clock(Clock *clock, int latitude, int longitude, int timezone);
+
+// Bring a batch of clocks up to a UTC day of the year (as in tm_yday, and may
+// be one past either end of the year) and time in minutes. The sun's terms
+// are looked up once for the whole batch, and each clock is only solved again
+// when its local day changes, so a minute tick costs a few integer
+// operations per clock.
+void update_clocks(Clock *clocks, int count, int utc_day, int utc_minutes);
@@ -0,0 +1,350 @@
+// Offline batch renderer. Renders the map for every day of the year at every
+// STEP minutes of UTC (35,040 frames at the default 15 minutes) on a pool of
+// threads, and writes the frames as PBM files or into one packed file.
+//
+// A frame is the whole map as render_map() draws it or, with -x, the screen
+// panned to that column, as the app's layer update draws it into the frame
+// buffer. The home marker and sunrise text aren't drawn.
+//
+// Threads take frames from a shared counter BATCH_CHUNK at a time, so one
+// slow chunk doesn't hold the others up. Each thread has its own render state
+// (see RENDER_THREAD_LOCAL in render.h) and renders its chunk in order, so
+// the profile of a day is only calculated once per chunk.
+//
+// The packed file is, all little-endian:
+//   char   magic[4]     "WMAP"
+//   uint16 width
+//   uint16 height
+//   uint16 step         minutes between frames
+//   uint16 flags        bit 0: twilight bands
+//   uint32 frames
+// followed by each frame, in order of day then time, as height rows of
+// (width + 7) / 8 bytes with the leftmost pixel in the high bit and 1 for
+// black, like a PBM raster.
+//
+// With -d each frame's night masks are worked out pixel by pixel by the
+// widest of the vector kernels in classify.c that the CPU has, rather than
+// from the day's profiles. With -t the frames are the same. Without it the
+// terminator is the exact one rather than the app's, which is interpolated
+// from terminator_table.h, so a few dozen pixels a frame can differ.
+//
+// usage: batch [-j THREADS] [-s STEP] [-t] [-d] [-x OFFSET] (-o DIR | -p FILE | -b)
+//   -j  threads, the number of cores by default
+//   -s  minutes between frames, 15 by default
+//   -t  draw the twilight bands
+//   -d  classify every pixel directly
+//   -x  render the screen with this column of the map at its left edge
+//       (wrapping around), rather than the whole map
+//   -o  write DIR/DDD-HHMM.pbm for each frame
+//   -p  write the packed file
+//   -b  render without writing anything at 1, 2, 4 ... THREADS threads and
+//       report frames/s
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "classify.h"
+#include "land_map.h"
+#include "render.h"
+
+#ifndef LAND_MAP_PATH
+#define LAND_MAP_PATH "../resources/data/world_map.rle"
+#endif
+
+#define DAYS 365
+#define BATCH_CHUNK 16
+#define MAX_THREADS 256
+#define PACKED_HEADER 16
+
+// The frame set
+int g_step = 15;
+int g_twilight_bands = 0;
+int g_classify = 0;
+int g_x_offset = -1;
+int g_frames = 0;
+
+// Size of a frame, and its size as a PBM raster
+int g_width = MAP_WIDTH;
+int g_height = MAP_HEIGHT;
+int g_raster_row = (MAP_WIDTH + 7) / 8;
+
+// Where frames go: a directory of PBMs, a packed file, or nowhere
+const char *g_pbm_dir = 0;
+int g_packed_fd = -1;
+
+// Next frame for a thread to take
+int g_next_frame = 0;
+
+// The land map resource, shared by all threads
+uint8_t g_land_map[16384];
+
+// Byte with its bits reversed, and inverted: the app's bitmaps have the
+// leftmost pixel in the low bit and 1 for white
+uint8_t g_raster_byte[256];
+
+void read_land_map_memory(uint32_t offset, uint8_t *buffer, int length) {
+    memcpy(buffer, &g_land_map[offset], length);
+}
+
+long long now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Render a frame from night masks classified pixel by pixel
+void classify_frame(uint32_t *bitmap, int row_words, int day, int rotation) {
+    uint32_t night[MAP_HEIGHT][MAX_BANDS][MAP_ROW_WORDS];
+    uint32_t row[MAP_ROW_WORDS];
+    int bands = g_twilight_bands ? MAX_BANDS : 1;
+    int y;
+
+    classify_map(night, bands, day, rotation);
+    for (y = 0; y < g_height; y++) {
+        if (g_x_offset < 0) {
+            stipple_row(&bitmap[y * MAP_ROW_WORDS], y, (const uint32_t (*)[MAP_ROW_WORDS])night[y],
+                    bands);
+        } else {
+            stipple_row(row, y, (const uint32_t (*)[MAP_ROW_WORDS])night[y], bands);
+            copy_window_row(&bitmap[y * row_words], row_words, row, g_x_offset);
+        }
+    }
+}
+
+// Render frame number index into bitmap, which has row_words words per row
+void render_frame(int index, uint32_t *bitmap, int row_words) {
+    int frames_per_day = 1440 / g_step;
+    int day = index / frames_per_day;
+    int minutes = (index % frames_per_day) * g_step;
+    int rotation = calc_rotation(day, minutes);
+
+    if (g_classify) {
+        classify_frame(bitmap, row_words, day, rotation);
+    } else if (g_x_offset < 0) {
+        render_map(bitmap, day, rotation);
+    } else {
+        render_map_window(bitmap, row_words, g_height, g_x_offset, day, rotation);
+    }
+}
+
+// Convert a bitmap to a PBM raster
+void to_raster(const uint32_t *bitmap, int row_words, uint8_t *raster) {
+    int y, i;
+    for (y = 0; y < g_height; y++) {
+        const uint8_t *row = (const uint8_t *)&bitmap[y * row_words];
+        for (i = 0; i < g_raster_row; i++) {
+            raster[y * g_raster_row + i] = g_raster_byte[row[i]];
+        }
+        // Padding past the right edge is white
+        if (g_width & 7) {
+            raster[y * g_raster_row + g_raster_row - 1] &= 0xFF << (8 - (g_width & 7));
+        }
+    }
+}
+
+int write_frame(int index, const uint8_t *raster) {
+    int size = g_height * g_raster_row;
+
+    if (g_pbm_dir) {
+        int frames_per_day = 1440 / g_step;
+        int minutes = (index % frames_per_day) * g_step;
+        char path[4096];
+        FILE *f;
+
+        snprintf(path, sizeof(path), "%s/%03d-%02d%02d.pbm", g_pbm_dir,
+                index / frames_per_day, minutes / 60, minutes % 60);
+        f = fopen(path, "wb");
+        if (!f) {
+            return -1;
+        }
+        fprintf(f, "P4\n%d %d\n", g_width, g_height);
+        fwrite(raster, 1, size, f);
+        return fclose(f);
+    }
+    if (g_packed_fd >= 0) {
+        off_t offset = PACKED_HEADER + (off_t)index * size;
+        return (pwrite(g_packed_fd, raster, size, offset) == size) ? 0 : -1;
+    }
+    return 0;
+}
+
+// Worker thread: take chunks of frames until there are none left. Returns
+// non-zero if a frame couldn't be written.
+void *worker(void *arg) {
+    uint32_t bitmap[MAP_ROW_WORDS * MAP_HEIGHT];
+    uint8_t raster[MAP_HEIGHT * ((MAP_WIDTH + 7) / 8)];
+    int row_words = (g_x_offset < 0) ? MAP_ROW_WORDS : (SCREEN_WIDTH + 31) >> 5;
+    int writing = g_pbm_dir || g_packed_fd >= 0;
+    (void)arg;
+
+    set_twilight(g_twilight_bands);
+    for (;;) {
+        int first = __sync_fetch_and_add(&g_next_frame, BATCH_CHUNK);
+        int index, last = first + BATCH_CHUNK;
+        if (first >= g_frames) {
+            break;
+        }
+        if (last > g_frames) last = g_frames;
+
+        for (index = first; index < last; index++) {
+            render_frame(index, bitmap, row_words);
+            if (writing) {
+                to_raster(bitmap, row_words, raster);
+                if (write_frame(index, raster) < 0) {
+                    return (void *)1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Render the whole set on the given number of threads. Returns the time
+// taken in ns, or -1 if something failed.
+long long run(int threads) {
+    pthread_t ids[MAX_THREADS];
+    long long start = now_ns();
+    int i, failed = 0;
+
+    g_next_frame = 0;
+    for (i = 0; i < threads; i++) {
+        if (pthread_create(&ids[i], 0, worker, 0) != 0) {
+            threads = i;
+            failed = 1;
+            break;
+        }
+    }
+    for (i = 0; i < threads; i++) {
+        void *result;
+        pthread_join(ids[i], &result);
+        failed |= result != 0;
+    }
+    return failed ? -1 : now_ns() - start;
+}
+
+int write_packed_header() {
+    uint8_t header[PACKED_HEADER] = {'W', 'M', 'A', 'P'};
+    header[4] = g_width & 0xFF;
+    header[5] = g_width >> 8;
+    header[6] = g_height & 0xFF;
+    header[7] = g_height >> 8;
+    header[8] = g_step & 0xFF;
+    header[9] = g_step >> 8;
+    header[10] = g_twilight_bands;
+    header[12] = g_frames & 0xFF;
+    header[13] = (g_frames >> 8) & 0xFF;
+    header[14] = (g_frames >> 16) & 0xFF;
+    header[15] = g_frames >> 24;
+    return (pwrite(g_packed_fd, header, sizeof(header), 0) == sizeof(header)) ? 0 : -1;
+}
+
+void usage() {
+    fprintf(stderr, "usage: batch [-j THREADS] [-s STEP] [-t] [-d] [-x OFFSET] "
+            "(-o DIR | -p FILE | -b)\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char *packed_path = 0;
+    int benchmark = 0;
+    long long ns;
+    int opt, i;
+    FILE *f;
+
+    while ((opt = getopt(argc, argv, "j:s:tdx:o:p:b")) != -1) {
+        switch (opt) {
+        case 'j': threads = atoi(optarg); break;
+        case 's': g_step = atoi(optarg); break;
+        case 't': g_twilight_bands = 1; break;
+        case 'd': g_classify = 1; break;
+        case 'x': g_x_offset = atoi(optarg); break;
+        case 'o': g_pbm_dir = optarg; break;
+        case 'p': packed_path = optarg; break;
+        case 'b': benchmark = 1; break;
+        default: usage();
+        }
+    }
+    if (threads < 1 || threads > MAX_THREADS || g_step < 1 || 1440 % g_step != 0 ||
+            g_x_offset >= MAP_WIDTH ||
+            (!!g_pbm_dir + !!packed_path + benchmark) != 1) {
+        usage();
+    }
+    if (g_x_offset >= 0) {
+        g_width = SCREEN_WIDTH;
+        g_height = (SCREEN_HEIGHT < MAP_HEIGHT) ? SCREEN_HEIGHT : MAP_HEIGHT;
+        g_raster_row = (g_width + 7) / 8;
+    }
+    g_frames = DAYS * (1440 / g_step);
+
+    for (i = 0; i < 256; i++) {
+        int bit, reversed = 0;
+        for (bit = 0; bit < 8; bit++) {
+            reversed |= ((i >> bit) & 1) << (7 - bit);
+        }
+        g_raster_byte[i] = ~reversed;
+    }
+
+    f = fopen(LAND_MAP_PATH, "rb");
+    if (!f) {
+        fprintf(stderr, "can't open %s\n", LAND_MAP_PATH);
+        return 1;
+    }
+    if (fread(g_land_map, 1, sizeof(g_land_map), f) == 0) {
+        fprintf(stderr, "can't read %s\n", LAND_MAP_PATH);
+        return 1;
+    }
+    fclose(f);
+    init_land_map(read_land_map_memory);
+    if (g_classify) {
+        classify_select(NULL);
+    }
+
+    if (benchmark) {
+        double single = 0;
+        int n;
+        printf("%d frames of %dx%d\n", g_frames, g_width, g_height);
+        if (g_classify) {
+            printf("classified with %s\n", g_classify_kernel->name);
+        }
+        for (n = 1; ; n = (n * 2 < threads) ? n * 2 : threads) {
+            double fps;
+            ns = run(n);
+            if (ns < 0) {
+                fprintf(stderr, "can't start %d threads\n", n);
+                return 1;
+            }
+            fps = g_frames * 1e9 / ns;
+            if (n == 1) single = fps;
+            printf("%3d threads %10.0f frames/s %6.2fx\n", n, fps, fps / single);
+            if (n == threads) break;
+        }
+        return 0;
+    }
+
+    if (packed_path) {
+        g_packed_fd = open(packed_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (g_packed_fd < 0 || write_packed_header() < 0) {
+            fprintf(stderr, "can't write %s\n", packed_path);
+            return 1;
+        }
+    }
+    ns = run(threads);
+    if (g_packed_fd >= 0 && close(g_packed_fd) < 0) {
+        ns = -1;
+    }
+    if (ns < 0) {
+        fprintf(stderr, "failed writing frames\n");
+        return 1;
+    }
+    printf("%d frames on %d threads in %.2f s, %.0f frames/s\n",
+            g_frames, threads, ns / 1e9, g_frames * 1e9 / ns);
+    return 0;
+}
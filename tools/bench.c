@@ -0,0 +1,410 @@
+// Renderer benchmark. Renders the map for every day of the year at every
+// 15 minutes and reports time per frame, pixel throughput and, where the
+// kernel allows it, instructions per pixel.
+//
+// The renderer caches the terminator profile per day, so the first frame of
+// each day (a full render) is reported separately from the rest (a re-render
+// at a new time of day). Minute ticks go through update_map(), which only
+// recomposites the columns that moved. "twilight" re-renders the same
+// frames with the twilight bands on; its first frame of each day, which
+// scans the band profiles, is reported as "twilight day".
+//
+// The land map is loaded from the resource the app ships, and read from
+// memory a row at a time just like the watch reads it from flash. "rle rows"
+// decodes the whole map that way; "raw rows" copies the same rows out of a
+// plain bitmap, for comparison.
+//
+// A redraw of the screen either blits the visible part of the map bitmap into
+// the frame buffer ("blit"), or composites it straight into the frame buffer
+// with no map bitmap at all ("frame buffer"); both are timed at views all the
+// way around the globe, as panning passes through them.
+//
+// "night KERNEL" classifies every pixel of the map against the twilight
+// bands, the way batch -d does, with each of the kernels in classify.c that
+// the CPU can run, once a week at every hour. Every kernel's masks have to
+// match the scalar kernel's bit for bit; the frames that don't are counted.
+//
+// "clocks" brings home and three cities' clocks up to each minute of the
+// year, which only solves for sunrise and sunset when a clock's day changes;
+// "clocks day" is the minute of each day on which home's does.
+//
+// "projection" converts every whole degree of longitude at a latitude to a
+// pixel and back, and the rows that don't convert back to themselves are
+// counted.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "classify.h"
+#include "land_map.h"
+#include "projection.h"
+#include "render.h"
+#include "sunrise.h"
+#include "world_clock.h"
+
+#define MAP_PIXELS (MAP_WIDTH * MAP_HEIGHT)
+#define TICKS_PER_DAY 96
+#define MAP_DECODES 10000
+
+// Relative to tools/, where "make bench" runs
+#ifndef LAND_MAP_PATH
+#define LAND_MAP_PATH "../resources/data/world_map.rle"
+#endif
+
+uint32_t g_bmpdata[MAP_ROW_WORDS * MAP_HEIGHT];
+
+// A 1-bit frame buffer the size of the screen, rows padded to whole words
+#define FRAME_ROW_WORDS ((SCREEN_WIDTH + 31) >> 5)
+uint32_t g_frame_buffer[FRAME_ROW_WORDS * SCREEN_HEIGHT];
+
+// Night masks from the scalar kernel, and from the one being timed
+uint32_t g_reference_night[MAP_HEIGHT][MAX_BANDS][MAP_ROW_WORDS];
+uint32_t g_night[MAP_HEIGHT][MAX_BANDS][MAP_ROW_WORDS];
+
+// The land map resource, and the same map as a plain bitmap
+uint8_t g_land_map[16384];
+uint32_t g_land_bitmap[MAP_ROW_WORDS * MAP_HEIGHT];
+
+void read_land_map_memory(uint32_t offset, uint8_t *buffer, int length) {
+    memcpy(buffer, &g_land_map[offset], length);
+}
+
+// Instruction counter, or -1 if perf events aren't available
+int g_perf_fd = -1;
+
+void perf_open() {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    g_perf_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+void perf_start() {
+#ifdef __linux__
+    if (g_perf_fd >= 0) {
+        ioctl(g_perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(g_perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+long long perf_stop() {
+    long long count = -1;
+#ifdef __linux__
+    if (g_perf_fd >= 0) {
+        ioctl(g_perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(g_perf_fd, &count, sizeof(count)) != sizeof(count)) {
+            count = -1;
+        }
+    }
+#endif
+    return count;
+}
+
+long long now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Accumulated cost of one kind of frame
+typedef struct {
+    const char *name;
+    long long frames;
+    long long ns;
+    long long instructions;
+} Stat;
+
+void add_sample(Stat *stat, long long ns, long long instructions) {
+    stat->frames++;
+    stat->ns += ns;
+    if (instructions < 0 || stat->instructions < 0) {
+        stat->instructions = -1;
+    } else {
+        stat->instructions += instructions;
+    }
+}
+
+// pixels_per_frame is the number of map pixels (or for the sunrise solver,
+// solves, for the projection points and for the world clocks clocks) each
+// frame covers
+void report(const Stat *stat, long long pixels_per_frame, const char *unit) {
+    double ns_per_frame = (double)stat->ns / stat->frames;
+    printf("%-14s %8lld frames %10.0f ns/frame %10.1f M%ss/s",
+            stat->name, stat->frames, ns_per_frame,
+            pixels_per_frame * 1e3 / ns_per_frame, unit);
+    if (stat->instructions >= 0) {
+        printf(" %8.2f instructions/%s",
+                (double)stat->instructions / (stat->frames * pixels_per_frame), unit);
+    } else {
+        printf("   instructions/%s n/a", unit);
+    }
+    printf("\n");
+}
+
+int main(void) {
+    Stat full = {"full render", 0, 0, 0};
+    Stat tick = {"time of day", 0, 0, 0};
+    Stat sunrise = {"sunrise solve", 0, 0, 0};
+    Stat minute = {"minute tick", 0, 0, 0};
+    Stat rle_rows = {"rle rows", 0, 0, 0};
+    Stat raw_rows = {"raw rows", 0, 0, 0};
+    Stat twilight_day = {"twilight day", 0, 0, 0};
+    Stat twilight = {"twilight", 0, 0, 0};
+    Stat blit = {"blit", 0, 0, 0};
+    Stat frame_buffer = {"frame buffer", 0, 0, 0};
+    Stat projection = {"projection", 0, 0, 0};
+    Stat clocks_day = {"clocks day", 0, 0, 0};
+    Stat clocks = {"clocks", 0, 0, 0};
+    Stat classify[8];
+    char classify_names[8][16];
+    int classify_mismatches = 0, k;
+    Clock clock_list[MAX_CLOCKS];
+    long long changed_columns = 0;
+    int32_t checksum = 0;
+    int projection_misses = 0;
+    size_t map_size;
+    int day, t, y;
+    FILE *f;
+
+    f = fopen(LAND_MAP_PATH, "rb");
+    if (!f) {
+        printf("can't open %s\n", LAND_MAP_PATH);
+        return 1;
+    }
+    map_size = fread(g_land_map, 1, sizeof(g_land_map), f);
+    fclose(f);
+    init_land_map(read_land_map_memory);
+    for (y = 0; y < MAP_HEIGHT; y++) {
+        read_land_row(y, &g_land_bitmap[y * MAP_ROW_WORDS]);
+    }
+
+    perf_open();
+    if (g_perf_fd < 0) {
+        printf("perf events unavailable, not counting instructions\n");
+    }
+
+    for (day = 0; day < 365; day++) {
+        for (t = 0; t < TICKS_PER_DAY; t++) {
+            int rotation = calc_rotation(day, t * 1440 / TICKS_PER_DAY);
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            render_map(g_bmpdata, day, rotation);
+            add_sample((t == 0) ? &full : &tick, now_ns() - start, perf_stop());
+        }
+    }
+
+    set_twilight(1);
+    for (day = 0; day < 365; day++) {
+        for (t = 0; t < TICKS_PER_DAY; t++) {
+            int rotation = calc_rotation(day, t * 1440 / TICKS_PER_DAY);
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            render_map(g_bmpdata, day, rotation);
+            add_sample((t == 0) ? &twilight_day : &twilight, now_ns() - start, perf_stop());
+        }
+    }
+    set_twilight(0);
+
+    // Every day at a spread of latitudes
+    for (day = 0; day < 365; day++) {
+        int latitude;
+        for (latitude = -80; latitude <= 80; latitude += 5) {
+            int sunrise_time, sunset_time;
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            sun_times(latitude, -122, day, -16, &sunrise_time, &sunset_time);
+            add_sample(&sunrise, now_ns() - start, perf_stop());
+        }
+    }
+
+    // A week apart, every minute of the day as the app sees it
+    for (day = 0; day < 365; day += 7) {
+        render_map(g_bmpdata, day, calc_rotation(day, 0));
+        for (t = 0; t < 1440; t++) {
+            int rotation = calc_rotation(day, t);
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            changed_columns += update_map(g_bmpdata, day, rotation);
+            add_sample(&minute, now_ns() - start, perf_stop());
+        }
+    }
+
+    // The whole land map, a row at a time
+    for (t = 0; t < MAP_DECODES; t++) {
+        uint32_t row[MAP_ROW_WORDS];
+        long long start;
+
+        perf_start();
+        start = now_ns();
+        for (y = 0; y < MAP_HEIGHT; y++) {
+            read_land_row(y, row);
+        }
+        add_sample(&rle_rows, now_ns() - start, perf_stop());
+
+        perf_start();
+        start = now_ns();
+        for (y = 0; y < MAP_HEIGHT; y++) {
+            memcpy(row, &g_land_bitmap[y * MAP_ROW_WORDS], sizeof(row));
+        }
+        add_sample(&raw_rows, now_ns() - start, perf_stop());
+    }
+
+    // Redraws as the view pans once around the globe, 3 columns a step,
+    // including the views that wrap around the edge of the map, once a week
+    // at noon UTC
+    for (day = 0; day < 365; day += 7) {
+        int rotation = calc_rotation(day, 720);
+        int x_offset;
+
+        render_map(g_bmpdata, day, rotation);
+        for (x_offset = 0; x_offset < MAP_WIDTH; x_offset += 3) {
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            for (y = 0; y < SCREEN_HEIGHT; y++) {
+                copy_window_row(&g_frame_buffer[y * FRAME_ROW_WORDS], FRAME_ROW_WORDS,
+                        &g_bmpdata[y * MAP_ROW_WORDS], x_offset);
+            }
+            add_sample(&blit, now_ns() - start, perf_stop());
+
+            perf_start();
+            start = now_ns();
+            render_map_window(g_frame_buffer, FRAME_ROW_WORDS, SCREEN_HEIGHT, x_offset,
+                    day, rotation);
+            add_sample(&frame_buffer, now_ns() - start, perf_stop());
+        }
+    }
+
+    // Every pixel classified by each kernel, against the scalar kernel
+    for (k = 0; k < CLASSIFY_KERNEL_COUNT; k++) {
+        snprintf(classify_names[k], sizeof(classify_names[k]), "night %s",
+                CLASSIFY_KERNELS[k].name);
+        classify[k] = (Stat){classify_names[k], 0, 0, 0};
+    }
+    for (day = 0; day < 365; day += 7) {
+        for (t = 0; t < 24; t++) {
+            int rotation = calc_rotation(day, t * 60);
+
+            for (k = 0; k < CLASSIFY_KERNEL_COUNT; k++) {
+                uint32_t (*night)[MAX_BANDS][MAP_ROW_WORDS] = k ? g_night : g_reference_night;
+                long long start;
+
+                if (!classify_select(CLASSIFY_KERNELS[k].name)) {
+                    continue;
+                }
+                perf_start();
+                start = now_ns();
+                classify_map(night, MAX_BANDS, day, rotation);
+                add_sample(&classify[k], now_ns() - start, perf_stop());
+                if (k && memcmp(g_night, g_reference_night, sizeof(g_night)) != 0) {
+                    classify_mismatches++;
+                }
+            }
+        }
+    }
+
+    // Home 8 hours behind UTC, like the app's default, so its day changes at
+    // 08:00 UTC
+    set_clock(&clock_list[0], 37, -122, -16);
+    for (t = 1; t < MAX_CLOCKS; t++) {
+        set_clock(&clock_list[t], CITIES[t * 3].latitude, CITIES[t * 3].longitude,
+                CITIES[t * 3].timezone);
+    }
+    for (day = 0; day < 365; day++) {
+        for (t = 0; t < 1440; t++) {
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            update_clocks(clock_list, MAX_CLOCKS, day, t);
+            add_sample((t == 480) ? &clocks_day : &clocks, now_ns() - start, perf_stop());
+        }
+    }
+
+    // Every whole degree, to a pixel and back
+    for (t = 0; t < 100; t++) {
+        int latitude;
+        for (latitude = -90; latitude <= 90; latitude++) {
+            int longitude;
+            long long start;
+
+            perf_start();
+            start = now_ns();
+            for (longitude = -180; longitude < 180; longitude++) {
+                int x = projection_x(longitude * PROJECTION_DEGREE);
+                int y = projection_y(latitude * PROJECTION_DEGREE);
+                checksum += projection_longitude(x);
+                if (y >= 0 && y < MAP_HEIGHT) {
+                    checksum += projection_latitude(y);
+                }
+            }
+            add_sample(&projection, now_ns() - start, perf_stop());
+        }
+    }
+    for (y = 0; y < MAP_HEIGHT; y++) {
+        projection_misses += projection_y(projection_latitude(y)) != y;
+    }
+
+    report(&full, MAP_PIXELS, "pixel");
+    report(&tick, MAP_PIXELS, "pixel");
+    report(&minute, MAP_PIXELS, "pixel");
+    printf("%.1f columns changed per minute tick\n", (double)changed_columns / minute.frames);
+    report(&twilight_day, MAP_PIXELS, "pixel");
+    report(&twilight, MAP_PIXELS, "pixel");
+    report(&sunrise, 1, "solve");
+    report(&rle_rows, MAP_PIXELS, "pixel");
+    report(&raw_rows, MAP_PIXELS, "pixel");
+    report(&blit, SCREEN_WIDTH * SCREEN_HEIGHT, "pixel");
+    report(&frame_buffer, SCREEN_WIDTH * SCREEN_HEIGHT, "pixel");
+    for (k = 0; k < CLASSIFY_KERNEL_COUNT; k++) {
+        if (classify[k].frames == 0) {
+            printf("%-14s not supported by this CPU\n", classify[k].name);
+            continue;
+        }
+        report(&classify[k], MAP_PIXELS, "pixel");
+    }
+    printf("night kernels against scalar:");
+    for (k = 1; k < CLASSIFY_KERNEL_COUNT; k++) {
+        if (classify[k].frames > 0) {
+            printf(" %s %.2fx,", CLASSIFY_KERNELS[k].name, (double)classify[0].ns /
+                    classify[0].frames / ((double)classify[k].ns / classify[k].frames));
+        }
+    }
+    printf(" %d frames differ\n", classify_mismatches);
+    report(&clocks_day, MAX_CLOCKS, "clock");
+    report(&clocks, MAX_CLOCKS, "clock");
+    report(&projection, 360, "point");
+    printf("projection: %d of %d rows don't convert back (checksum %d)\n",
+            projection_misses, MAP_HEIGHT, (int)checksum);
+    printf("land map: %d bytes as row spans, %d as a raw bitmap\n",
+            (int)map_size, MAP_HEIGHT * MAP_WIDTH / 8);
+    printf("map bitmap: %d bytes, none when rendering to the frame buffer\n",
+            (int)sizeof(g_bmpdata));
+    return 0;
+}
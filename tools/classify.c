@@ -0,0 +1,159 @@
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "classify.h"
+#include "ephemeris.h"
+
+// The reference: one calc_dp() and one comparison per band at a time
+void classify_row_scalar(uint32_t night[][MAP_ROW_WORDS], int bands, const int16_t *terms,
+        const int32_t *thresholds, int32_t cos_phi, int32_t sin_phi) {
+    int i, bit, band;
+
+    for (i = 0; i < MAP_ROW_WORDS; i++) {
+        uint32_t words[MAX_BANDS] = {0};
+
+        for (bit = 0; bit < 32; bit++) {
+            const int16_t *column = &terms[(i * 32 + bit) * 2];
+            int32_t dp = calc_dp(cos_phi, sin_phi, column[0], column[1]);
+
+            for (band = 0; band < bands; band++) {
+                if (dp > thresholds[band]) {
+                    words[band] |= (uint32_t)1 << bit;
+                }
+            }
+        }
+        for (band = 0; band < bands; band++) {
+            night[band][i] = words[band];
+        }
+    }
+}
+
+int always_supported(void) {
+    return 1;
+}
+
+#ifdef __SSE2__
+// calc_dp() is a multiply-add of int16 pairs, which is what pmaddwd does: 4
+// columns per instruction. Each band's comparisons are narrowed to bytes and
+// packed into 16 bits at a time with pmovmskb.
+void classify_row_sse2(uint32_t night[][MAP_ROW_WORDS], int bands, const int16_t *terms,
+        const int32_t *thresholds, int32_t cos_phi, int32_t sin_phi) {
+    __m128i phi = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)sin_phi << 16) | (uint16_t)cos_phi));
+    int i, j, band;
+
+    for (i = 0; i < MAP_ROW_WORDS; i++) {
+        const __m128i *columns = (const __m128i *)&terms[i * 64];
+        __m128i dp[8];
+
+        for (j = 0; j < 8; j++) {
+            dp[j] = _mm_madd_epi16(_mm_loadu_si128(&columns[j]), phi);
+        }
+        for (band = 0; band < bands; band++) {
+            __m128i threshold = _mm_set1_epi32(thresholds[band]);
+            __m128i low = _mm_packs_epi16(
+                    _mm_packs_epi32(_mm_cmpgt_epi32(dp[0], threshold), _mm_cmpgt_epi32(dp[1], threshold)),
+                    _mm_packs_epi32(_mm_cmpgt_epi32(dp[2], threshold), _mm_cmpgt_epi32(dp[3], threshold)));
+            __m128i high = _mm_packs_epi16(
+                    _mm_packs_epi32(_mm_cmpgt_epi32(dp[4], threshold), _mm_cmpgt_epi32(dp[5], threshold)),
+                    _mm_packs_epi32(_mm_cmpgt_epi32(dp[6], threshold), _mm_cmpgt_epi32(dp[7], threshold)));
+            night[band][i] = (uint32_t)_mm_movemask_epi8(low) |
+                ((uint32_t)_mm_movemask_epi8(high) << 16);
+        }
+    }
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+// The same 8 columns at a time, and a whole word per pmovmskb. The packs work
+// within each 128-bit lane, which leaves the word's four groups of 4 bytes from
+// each lane interleaved; vpermd puts them back in order.
+__attribute__((target("avx2")))
+void classify_row_avx2(uint32_t night[][MAP_ROW_WORDS], int bands, const int16_t *terms,
+        const int32_t *thresholds, int32_t cos_phi, int32_t sin_phi) {
+    __m256i phi = _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)sin_phi << 16) | (uint16_t)cos_phi));
+    __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i, j, band;
+
+    for (i = 0; i < MAP_ROW_WORDS; i++) {
+        const __m256i *columns = (const __m256i *)&terms[i * 64];
+        __m256i dp[4];
+
+        for (j = 0; j < 4; j++) {
+            dp[j] = _mm256_madd_epi16(_mm256_loadu_si256(&columns[j]), phi);
+        }
+        for (band = 0; band < bands; band++) {
+            __m256i threshold = _mm256_set1_epi32(thresholds[band]);
+            __m256i packed = _mm256_packs_epi16(
+                    _mm256_packs_epi32(_mm256_cmpgt_epi32(dp[0], threshold),
+                        _mm256_cmpgt_epi32(dp[1], threshold)),
+                    _mm256_packs_epi32(_mm256_cmpgt_epi32(dp[2], threshold),
+                        _mm256_cmpgt_epi32(dp[3], threshold)));
+            packed = _mm256_permutevar8x32_epi32(packed, order);
+            night[band][i] = (uint32_t)_mm256_movemask_epi8(packed);
+        }
+    }
+}
+
+int avx2_supported(void) {
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+const ClassifyKernel CLASSIFY_KERNELS[] = {
+    {"scalar", classify_row_scalar, always_supported},
+#ifdef __SSE2__
+    {"sse2", classify_row_sse2, always_supported},
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    {"avx2", classify_row_avx2, avx2_supported},
+#endif
+};
+const int CLASSIFY_KERNEL_COUNT = sizeof(CLASSIFY_KERNELS) / sizeof(CLASSIFY_KERNELS[0]);
+
+const ClassifyKernel *g_classify_kernel = &CLASSIFY_KERNELS[0];
+
+const ClassifyKernel *classify_select(const char *name) {
+    int i;
+
+    for (i = CLASSIFY_KERNEL_COUNT - 1; i >= 0; i--) {
+        const ClassifyKernel *kernel = &CLASSIFY_KERNELS[i];
+        if ((!name || strcmp(name, kernel->name) == 0) && kernel->supported()) {
+            g_classify_kernel = kernel;
+            return kernel;
+        }
+    }
+    return NULL;
+}
+
+void classify_map(uint32_t night[][MAX_BANDS][MAP_ROW_WORDS], int bands, int day, int rotation) {
+    int16_t terms[MAP_ROW_WORDS * 32 * 2];
+    int32_t thresholds[MAX_BANDS];
+    int32_t sin_delta = sin_declination(day);
+    int32_t cos_delta = cos_declination(day);
+    int x, y, band;
+
+    // The terms only change from column to column, as in scan_band_profiles()
+    memset(terms, 0, sizeof(terms));
+    for (x = 0; x < MAP_WIDTH; x++) {
+        int32_t cos_theta, sin_theta, a, b;
+
+        calc_theta(x + rotation, &cos_theta, &sin_theta);
+        calc_dp_terms(cos_theta, sin_delta, cos_delta, &a, &b);
+        terms[x * 2] = (int16_t)a;
+        terms[x * 2 + 1] = (int16_t)b;
+    }
+    for (band = 0; band < bands; band++) {
+        thresholds[band] = BAND_SIN_DEPRESSION[band] << 15;
+    }
+
+    for (y = 0; y < MAP_HEIGHT; y++) {
+        int32_t cos_phi, sin_phi;
+
+        calc_phi(y, &cos_phi, &sin_phi);
+        g_classify_kernel->classify_row(night[y], bands, terms, thresholds, cos_phi, sin_phi);
+    }
+}
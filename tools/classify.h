@@ -0,0 +1,45 @@
+// Day/night classification of every pixel of the map on the host, for the
+// batch renderer and the benchmark. The watch gets each band's night mask
+// from a profile of the day (see scan_band_profiles() in src/render.c); this
+// works out calc_dp() for every pixel instead and packs the comparisons with
+// each band's depression into the same 32-pixel mask words, as many pixels
+// at a time as the CPU's vector unit allows.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "render.h"
+
+// Night masks of one row in the layout stipple_row() takes, for a kernel to
+// fill in from the calc_dp() terms of each column: a, b pairs of int16, for
+// MAP_ROW_WORDS * 32 columns (the padding's are 0, so it's never night), and
+// the row's cos and sin of latitude. thresholds[band] is the band's
+// depression, Q30.
+typedef void (*ClassifyRow)(uint32_t night[][MAP_ROW_WORDS], int bands, const int16_t *terms,
+        const int32_t *thresholds, int32_t cos_phi, int32_t sin_phi);
+
+typedef struct {
+    const char *name;
+    ClassifyRow classify_row;
+    // Whether this CPU can run it
+    int (*supported)(void);
+} ClassifyKernel;
+
+// The kernels built for this host, from the scalar reference to the widest;
+// all give the same masks
+extern const ClassifyKernel CLASSIFY_KERNELS[];
+extern const int CLASSIFY_KERNEL_COUNT;
+
+// Use the kernel of that name, or with NULL the widest this CPU supports.
+// Until this is called the scalar kernel is used. Returns the kernel, or NULL
+// if there's none of that name or the CPU can't run it.
+const ClassifyKernel *classify_select(const char *name);
+
+// The kernel in use
+extern const ClassifyKernel *g_classify_kernel;
+
+// The night masks of each of bands bands (1, or with twilight MAX_BANDS) for
+// every row of the map, for the day and rotation as render_map_start() takes
+// them
+void classify_map(uint32_t night[][MAX_BANDS][MAP_ROW_WORDS], int bands, int day, int rotation);
@@ -0,0 +1,216 @@
+#!/usr/bin/env python
+#
+# Generates angle_tables.h for a map size and projection: the cosine of each
+# column of hour angle, the latitude of each row with its cosine and sine, and
+# the row of each whole degree of latitude (see src/projection.c). The map
+# covers 360 degrees of longitude across its width, with the equator in the
+# middle row. Rows follow the projection:
+#   mercator         the same scale as the columns, so about 80 degrees either
+#                    side of the equator fit on the map
+#   equirectangular  latitude linear in the row, from 90 degrees at the top
+#
+# Only what the symmetry doesn't give is stored: the cosine of hour angle over
+# a quarter turn, and the rows from the top down to the equator, as the south
+# half mirrors the north. calc_theta() and calc_phi() in src/render.c and
+# projection_latitude() in src/projection.c unfold them.
+#
+# The trig tables can be stored as:
+#   float  32-bit floats, read by rounding to Q15 in soft float (the watch
+#          has no FPU)
+#   int16  Q15, 32767 == 1.0 (the default)
+#   int8   Q7, 127 == 1.0, read by shifting up to Q15
+# The renderer works in Q15 whichever is chosen. The size of the tables and
+# their largest error, as stored and as the renderer reads them, is printed
+# to stderr for each choice, to weigh one against another.
+#
+# Usage: python tools/gen_angle_tables.py WIDTH HEIGHT [PROJECTION [STORAGE]] > src/tables/WIDTHxHEIGHT/angle_tables.h
+# (PROJECTION is mercator by default; other projections' tables go in
+# src/tables/WIDTHxHEIGHT-PROJECTION/. make -C tools tables ANGLE_STORAGE=...
+# picks the storage for every size.)
+
+import math
+import struct
+import sys
+
+PROJECTIONS = ['mercator', 'equirectangular']
+
+# Latitudes are stored in 1/DEGREE degrees, and the row of each degree in
+# 1/ROW_STEPS rows (PROJECTION_DEGREE and PROJECTION_ROW_STEPS in
+# src/projection.h)
+DEGREE = 64
+ROW_STEPS = 256
+
+
+def q15(value):
+    """Q15 fixed point, with 1.0 clamped to 32767."""
+    return max(-32768, min(32767, int(round(value * 32768))))
+
+
+def q7(value):
+    """Q7 fixed point, with 1.0 clamped to 127."""
+    return max(-128, min(127, int(round(value * 128))))
+
+
+def float32(value):
+    """value rounded to a 32-bit float."""
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def float_literal(value):
+    """A C float literal, which needs a point or an exponent."""
+    text = '%.9g' % value
+    return text + ('f' if '.' in text or 'e' in text else '.0f')
+
+
+def float_q15(value):
+    """A stored float as ANGLE_Q15() reads it: rounded half away from zero,
+    with 1.0 clamped to 32767."""
+    q = int(value * 32768 + (-0.5 if value < 0 else 0.5))
+    return min(32767, q)
+
+
+# For each storage: the C type, the bytes per entry, how a value is stored,
+# what it is as stored, what ANGLE_Q15() makes of it, and how it's written out
+STORAGES = {
+    'float': ('float', 4, float32, lambda v: v, float_q15, float_literal),
+    'int16': ('int16_t', 2, q15, lambda v: v / 32768.0, lambda v: v, str),
+    'int8': ('int8_t', 1, q7, lambda v: v / 128.0, lambda v: v * 256, str),
+}
+
+# How ANGLE_Q15() is defined for each storage
+ANGLE_Q15 = {
+    'float': '''// Trig tables are 32-bit floats. ANGLE_Q15() rounds an entry to Q15, with 1.0
+// clamped to 32767, in soft float on the watch.
+static inline int32_t angle_q15(float v) {
+    int32_t q = (int32_t)(v * 32768.0f + ((v < 0) ? -0.5f : 0.5f));
+    return (q > 32767) ? 32767 : q;
+}
+#define ANGLE_Q15(v) angle_q15(v)
+''',
+    'int16': '''// Trig tables are Q15 fixed-point: 32767 == 1.0. ANGLE_Q15() reads an entry
+// as Q15.
+#define ANGLE_Q15(v) ((int32_t)(v))
+''',
+    'int8': '''// Trig tables are Q7 fixed-point: 127 == 1.0. ANGLE_Q15() reads an entry as
+// Q15.
+#define ANGLE_Q15(v) ((int32_t)(v) * 256)
+''',
+}
+
+
+def latitude(width, height, projection, y):
+    """Latitude (radians) of row y, which may be past the bottom row."""
+    if projection == 'mercator':
+        return math.atan(math.sinh(2 * math.pi / width * (height // 2 - y)))
+    return math.pi / height * (height // 2 - y)
+
+
+def latitudes(width, height, projection='mercator', rows=None):
+    """Latitude (radians) of each row."""
+    return [latitude(width, height, projection, y) for y in range(rows or height)]
+
+
+def rows_from_equator(width, height, projection, phi):
+    """How many rows north of the equator latitude phi (radians) is."""
+    if projection == 'mercator':
+        return width / (2 * math.pi) * math.asinh(math.tan(phi))
+    return phi * height / math.pi
+
+
+def trig_tables(width, height, projection):
+    """The exact values of the stored part of each trig table."""
+    lat = latitudes(width, height, projection, height // 2 + 1)
+    return {
+        'THETA_TABLE': [math.cos(2 * math.pi * i / width) for i in range(width // 4 + 1)],
+        'PHI_COS_TABLE': [math.cos(phi) for phi in lat],
+        'PHI_SIN_TABLE': [math.sin(phi) for phi in lat],
+    }
+
+
+def unfolded(width, height, projection, table, lookup):
+    """Pairs of (exact, looked up) for every column or row, where lookup
+    gives a stored entry's value and the table is unfolded as the C helpers
+    do it."""
+    if table == 'THETA_TABLE':
+        pairs = []
+        for x in range(width):
+            h = width - x if x > width // 2 else x
+            value = -lookup(width // 2 - h) if h > width // 4 else lookup(h)
+            pairs.append((math.cos(2 * math.pi * x / width), value))
+        return pairs
+    sign = -1 if table == 'PHI_SIN_TABLE' else 1
+    lat = latitudes(width, height, projection)
+    trig = math.sin if table == 'PHI_SIN_TABLE' else math.cos
+    return [(trig(lat[y]), lookup(y) if y <= height // 2 else sign * lookup(height - y))
+            for y in range(height)]
+
+
+def report(width, height, projection, chosen, out):
+    """Print the footprint and largest error of each storage."""
+    exact = trig_tables(width, height, projection)
+    entries = sum(len(values) for values in exact.values())
+    latitude_bytes = (height // 2 + 1) * 2 + 91 * 2
+    out.write('%dx%d %s angle tables: %d trig entries, and %d bytes of latitude tables\n' %
+              (width, height, projection, entries, latitude_bytes))
+    out.write('(all const, and flash and RAM alike, as the watch loads the app into RAM)\n')
+    out.write('  storage  trig bytes  max error stored  max error read (Q15 steps)\n')
+    for name in ('float', 'int16', 'int8'):
+        ctype, size, store, stored_value, read_q15, _ = STORAGES[name]
+        stored_error = read_error = 0
+        for table, values in exact.items():
+            stored = [store(v) for v in values]
+            for want, got in unfolded(width, height, projection, table,
+                                      lambda i: stored_value(stored[i])):
+                stored_error = max(stored_error, abs(got - want))
+            for want, got in unfolded(width, height, projection, table,
+                                      lambda i: read_q15(stored[i]) / 32768.0):
+                read_error = max(read_error, abs(got - want))
+        out.write('  %-6s %11d  %16.2g  %14.2g (%.2f)%s\n' % (
+            name, entries * size, stored_error, read_error, read_error * 32768,
+            '  <-' if name == chosen else ''))
+    out.write('  (int16 without the symmetry: %d bytes)\n' %
+              ((width // 2 + 1 + 2 * height) * 2))
+
+
+def main():
+    width, height = int(sys.argv[1]), int(sys.argv[2])
+    projection = sys.argv[3] if len(sys.argv) > 3 else 'mercator'
+    storage = sys.argv[4] if len(sys.argv) > 4 else 'int16'
+    assert width % 4 == 0 and height % 2 == 0 and projection in PROJECTIONS
+    assert storage in STORAGES
+
+    ctype, _, store, _, _, literal = STORAGES[storage]
+    tables = trig_tables(width, height, projection)
+    lat = latitudes(width, height, projection, height // 2 + 1)
+
+    # The poles are infinitely far away on a Mercator map, so the last entry is
+    # clamped, well off the map
+    row_of_degree = [min(65535, int(round(ROW_STEPS * rows_from_equator(
+        width, height, projection, math.radians(min(d, 89.99)))))) for d in range(91)]
+
+    def table(name):
+        return ','.join(literal(store(v)) for v in tables[name])
+
+    out = sys.stdout
+    out.write('// Angle tables for a %dx%d %s map, with the trig tables as %s. Generated\n' %
+              (width, height, projection, storage))
+    out.write('// by tools/gen_angle_tables.py, do not edit.\n\n')
+    out.write(ANGLE_Q15[storage] + '\n')
+    out.write('// Cosine of each column of hour angle over a quarter turn\n')
+    out.write('const %s THETA_TABLE[] = {%s};\n\n' % (ctype, table('THETA_TABLE')))
+    out.write('// Cosine and sine of the latitude of each row from the top to the equator\n')
+    out.write('const %s PHI_COS_TABLE[] = {%s};\n\n' % (ctype, table('PHI_COS_TABLE')))
+    out.write('const %s PHI_SIN_TABLE[] = {%s};\n\n' % (ctype, table('PHI_SIN_TABLE')))
+    out.write('// Latitude of each row from the top to the equator, in 1/%d degrees\n' % DEGREE)
+    out.write('const int16_t LATITUDE_TABLE[] = {%s};\n\n' %
+              ','.join(str(int(round(math.degrees(phi) * DEGREE))) for phi in lat))
+    out.write('// Rows north of the equator of each whole degree of latitude from 0 to 90,\n')
+    out.write('// in 1/%d rows\n' % ROW_STEPS)
+    out.write('const uint16_t LATITUDE_ROW_TABLE[] = {%s};\n' %
+              ','.join(str(v) for v in row_of_degree))
+
+    report(width, height, projection, storage, sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
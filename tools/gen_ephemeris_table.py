@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# Generates src/ephemeris_table.h, the sun's declination and the equation of
+# time for every day of the year.
+#
+# The values come from the NOAA solar calculator (Meeus' low-precision solar
+# coordinates), evaluated at noon UTC on each day of REFERENCE_YEAR. The sun
+# drifts by up to a quarter of a day over the leap year cycle; the size of
+# that drift is printed along with the quantisation error.
+#
+# Usage: python tools/gen_ephemeris_table.py > src/ephemeris_table.h
+# Size and accuracy numbers are printed to stderr.
+
+import math
+import sys
+
+# Day 365 only exists in leap years; it is filled in all the same so tm_yday
+# can index the table directly
+DAYS = 366
+
+# A year halfway between two leap years
+REFERENCE_YEAR = 2026
+
+# Equation of time is stored in 1/EOT_STEPS minutes
+EOT_STEPS = 4
+
+
+def julian_day(year, yday, hour=12.0):
+    """Julian day of the given day of the year (0-based) and UTC hour."""
+    y = year - 1
+    jd_jan0 = 1721424.5 + 365 * y + y // 4 - y // 100 + y // 400
+    return jd_jan0 + yday + hour / 24.0
+
+
+def sun_position(jd):
+    """Declination (radians) and equation of time (minutes), as in the NOAA
+    solar calculator."""
+    t = (jd - 2451545.0) / 36525.0
+    mean_long = math.radians((280.46646 + t * (36000.76983 + t * 0.0003032)) % 360)
+    mean_anom = math.radians(357.52911 + t * (35999.05029 - 0.0001537 * t))
+    ecc = 0.016708634 - t * (0.000042037 + 0.0000001267 * t)
+    centre = math.radians(math.sin(mean_anom) * (1.914602 - t * (0.004817 + 0.000014 * t)) +
+                          math.sin(2 * mean_anom) * (0.019993 - 0.000101 * t) +
+                          math.sin(3 * mean_anom) * 0.000289)
+    omega = math.radians(125.04 - 1934.136 * t)
+    app_long = mean_long + centre - math.radians(0.00569 + 0.00478 * math.sin(omega))
+    mean_obliq = 23 + (26 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60) / 60
+    obliq = math.radians(mean_obliq + 0.00256 * math.cos(omega))
+
+    declination = math.asin(math.sin(obliq) * math.sin(app_long))
+
+    y = math.tan(obliq / 2) ** 2
+    eot = (y * math.sin(2 * mean_long) - 2 * ecc * math.sin(mean_anom) +
+           4 * ecc * y * math.sin(mean_anom) * math.cos(2 * mean_long) -
+           0.5 * y * y * math.sin(4 * mean_long) - 1.25 * ecc * ecc * math.sin(2 * mean_anom))
+    return declination, math.degrees(eot) * 4
+
+
+def day_entry(yday):
+    """Q15 sine of the declination and equation of time in 1/EOT_STEPS
+    minutes for a day of the reference year."""
+    declination, eot = sun_position(julian_day(REFERENCE_YEAR, yday))
+    return (min(32767, int(round(math.sin(declination) * 32768))),
+            int(round(eot * EOT_STEPS)))
+
+
+def format_array(ctype, name, values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(','.join(str(v) for v in values[i:i + per_line]))
+    return 'const %s %s[] = {\n%s\n};\n' % (ctype, name, ',\n'.join(lines))
+
+
+def main():
+    entries = [day_entry(d) for d in range(DAYS)]
+
+    # Quantisation error, and how far other years are from the table. Leap
+    # years are compared before Feb 29 only, as after it their days are
+    # shifted by one.
+    max_decl_q = max_eot_q = 0
+    for d in range(DAYS):
+        declination, eot = sun_position(julian_day(REFERENCE_YEAR, d))
+        max_decl_q = max(max_decl_q, abs(math.degrees(math.asin(entries[d][0] / 32768.0)) -
+                                         math.degrees(declination)))
+        max_eot_q = max(max_eot_q, abs(entries[d][1] / float(EOT_STEPS) - eot))
+    max_decl_y = max_eot_y = 0
+    for year in range(REFERENCE_YEAR - 2, REFERENCE_YEAR + 3):
+        leap = year % 4 == 0
+        for d in range(59 if leap else 365):
+            declination, eot = sun_position(julian_day(year, d))
+            max_decl_y = max(max_decl_y, abs(math.degrees(math.asin(entries[d][0] / 32768.0)) -
+                                             math.degrees(declination)))
+            max_eot_y = max(max_eot_y, abs(entries[d][1] / float(EOT_STEPS) - eot))
+
+    sys.stderr.write('ephemeris table: %d bytes\n' % (3 * DAYS))
+    sys.stderr.write('quantisation: declination %.4f deg, equation of time %.3f min\n' %
+                     (max_decl_q, max_eot_q))
+    sys.stderr.write('%d-%d: declination %.3f deg, equation of time %.3f min\n' %
+                     (REFERENCE_YEAR - 2, REFERENCE_YEAR + 2, max_decl_y, max_eot_y))
+
+    out = sys.stdout
+    out.write('// Solar ephemeris for each day of the year, at noon UTC. Generated by\n')
+    out.write('// tools/gen_ephemeris_table.py, do not edit.\n\n')
+    out.write('#define EPHEMERIS_EOT_STEPS %d\n\n' % EOT_STEPS)
+    out.write('// Sine of the sun\'s declination, Q15, indexed by tm_yday\n')
+    out.write(format_array('int16_t', 'EPHEMERIS_SIN_DECLINATION', [e[0] for e in entries]))
+    out.write('\n// Equation of time (how far the sun is ahead of the clock) in\n')
+    out.write('// 1/EPHEMERIS_EOT_STEPS minutes, indexed by tm_yday\n')
+    out.write(format_array('int8_t', 'EPHEMERIS_EQUATION_OF_TIME', [e[1] for e in entries]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+# Generates the land map resource for a map size and projection, as row spans,
+# from the 1-bit master image tools/world_map.pbm (land is black). Both cover
+# 360 degrees of longitude with the equator in the middle row. The master is a
+# Mercator map, so other Mercator sizes are a nearest-neighbour scale of it
+# about the equator, and other projections take each row from the master row
+# at that row's latitude (see gen_angle_tables.py).
+#
+# Layout, all little-endian:
+#   uint16 row_offsets[height + 1]   start of each row's runs in the file; the
+#                                    last entry is the end of the file
+#   uint8  runs[]                    per row, alternating water and land run
+#                                    lengths, starting with water (a row that
+#                                    starts with land starts with a 0 run)
+#
+# The watch reads a row's offsets and runs through the resource API as it
+# renders, see read_land_row() in src/land_map.c.
+#
+# Usage: python tools/gen_land_map.py WIDTH HEIGHT [PROJECTION] > resources/data/world_map.rle
+# Size numbers are printed to stderr.
+
+import os
+import struct
+import sys
+
+import gen_angle_tables
+
+PBM = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'world_map.pbm')
+
+
+def read_pbm(path):
+    """Rows of 0/1 pixels from a binary (P4) PBM."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    assert fields[0] == b'P4'
+    width, height = int(fields[1]), int(fields[2])
+    pos += 1
+    stride = (width + 7) // 8
+    rows = []
+    for y in range(height):
+        row = bytearray(data[pos + y * stride:pos + (y + 1) * stride])
+        rows.append([(row[x >> 3] >> (7 - (x & 7))) & 1 for x in range(width)])
+    return width, height, rows
+
+
+def scale_map(src_width, src_height, src_rows, width, height, projection):
+    """Resample the master to width x height, water outside it."""
+    scale = float(src_width) / width
+    rows = []
+    for y in range(height):
+        if projection == 'mercator':
+            sy = int(round(src_height // 2 - (height // 2 - y) * scale))
+        else:
+            phi = gen_angle_tables.latitude(width, height, projection, y)
+            sy = int(round(src_height // 2 - gen_angle_tables.rows_from_equator(
+                src_width, src_height, 'mercator', max(-1.5, min(1.5, phi)))))
+        row = []
+        for x in range(width):
+            sx = int(round(x * scale)) % src_width
+            row.append(src_rows[sy][sx] if 0 <= sy < src_height else 0)
+        rows.append(row)
+    return rows
+
+
+def encode_row(row):
+    """Alternating water/land run lengths, starting with water."""
+    runs = []
+    value = 0
+    x = 0
+    while x < len(row):
+        end = x
+        while end < len(row) and row[end] == value:
+            end += 1
+        runs.append(end - x)
+        x = end
+        value ^= 1
+    return runs
+
+
+def main():
+    width, height = int(sys.argv[1]), int(sys.argv[2])
+    projection = sys.argv[3] if len(sys.argv) > 3 else 'mercator'
+    assert width < 256 and projection in gen_angle_tables.PROJECTIONS
+    rows = scale_map(*(read_pbm(PBM) + (width, height, projection)))
+
+    encoded = [encode_row(row) for row in rows]
+    header = 2 * (height + 1)
+    offsets = [header]
+    for runs in encoded:
+        offsets.append(offsets[-1] + len(runs))
+    assert offsets[-1] < 65536
+
+    out = bytearray(struct.pack('<%dH' % len(offsets), *offsets))
+    for runs in encoded:
+        out += bytearray(runs)
+
+    raw = height * ((width + 7) // 8)
+    sys.stderr.write('land map: %d bytes (%d offsets, %d runs), raw bitmap %d bytes (%.0f%%)\n' %
+                     (len(out), header, len(out) - header, raw, 100.0 * len(out) / raw))
+    sys.stderr.write('runs per row: max %d, mean %.1f\n' %
+                     (max(len(r) for r in encoded), float(len(out) - header) / height))
+
+    getattr(sys.stdout, 'buffer', sys.stdout).write(bytes(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,182 @@
+#!/usr/bin/env python
+#
+# Generates src/terminator_table.h, the precomputed day/night terminator.
+#
+# The terminator only depends on two things: the sun's declination, and the
+# sun's longitude, which just rotates it. For each of a handful of declination
+# buckets we store, for each column of hour angle, the row where the night
+# side ends. Only half the columns are stored, since the terminator is
+# symmetric around the midnight meridian. Only the northern-winter half of
+# the year is stored, since flipping the declination mirrors the map north to
+# south. The rows are monotonic in the hour angle, so they are delta-packed
+# into nibbles.
+#
+# The declination of each day comes from the ephemeris table (see
+# gen_ephemeris_table.py). The watch interpolates between the two nearest
+# buckets, so rendering a day needs no trig. Within a bucket of an equinox
+# the terminator is close to vertical, and a column next to it can go from
+# all day to all night over a fraction of a degree of declination, which
+# doesn't interpolate: the watch scans those days pixel by pixel instead (see
+# update_profile() in src/render.c), and bucket 0 isn't stored.
+#
+# Usage: python tools/gen_terminator_table.py WIDTH HEIGHT [PROJECTION] > src/tables/WIDTHxHEIGHT/terminator_table.h
+# Size and accuracy numbers are printed to stderr.
+
+import math
+import sys
+
+import gen_angle_tables
+import gen_ephemeris_table
+
+
+# Number of declination buckets between 0 and SIN_MAX
+BUCKETS = 17
+
+# Buckets are evenly spaced in the Q15 sine of the declination, up to just
+# over the Earth's tilt
+SIN_MAX = 13040
+
+
+
+def set_map_size(width, height, projection):
+    """Map size in pixels, and the latitude of each row. One extra row below
+    the map lets the table be mirrored north/south exactly around the equator
+    (the middle row)."""
+    global MAP_WIDTH, MAP_HEIGHT, HALF_WIDTH, COS_PHI, SIN_PHI
+    MAP_WIDTH, MAP_HEIGHT = width, height
+    HALF_WIDTH = width // 2
+    latitudes = gen_angle_tables.latitudes(width, height, projection, height + 1)
+    COS_PHI = [math.cos(phi) for phi in latitudes]
+    SIN_PHI = [math.sin(phi) for phi in latitudes]
+
+
+def night_rows(a, b, rows=None):
+    """Rows where cos(phi)*a + sin(phi)*b > 0, i.e. rows in darkness."""
+    if rows is None:
+        rows = MAP_HEIGHT
+    return [y for y in range(rows) if COS_PHI[y] * a + SIN_PHI[y] * b > 0]
+
+
+def float_model_night(declination, column):
+    """Set of night rows for a column of hour angle (0 is midnight) when the
+    sun is at the given declination (radians)."""
+    return set(night_rows(math.cos(2 * math.pi * column / MAP_WIDTH), -math.tan(declination)))
+
+
+def bucket_rows(bucket):
+    """Night rows from the top (0-MAP_HEIGHT+1) for each half-wave column of a
+    northern-winter declination bucket."""
+    sin_decl = SIN_MAX / 32768.0 * bucket / (BUCKETS - 1)
+    tan_decl = sin_decl / math.sqrt(1 - sin_decl * sin_decl)
+    return [len(night_rows(math.cos(2 * math.pi * h / MAP_WIDTH), tan_decl, MAP_HEIGHT + 1))
+            for h in range(HALF_WIDTH + 1)]
+
+
+def pack_rows(rows):
+    """First row as a byte, then one nibble per column holding how far the row
+    moved up. Nibble 15 escapes to an absolute row in the next two nibbles."""
+    nibbles = []
+    for h in range(1, len(rows)):
+        delta = rows[h - 1] - rows[h]
+        assert delta >= 0
+        if delta < 15:
+            nibbles.append(delta)
+        else:
+            nibbles += [15, rows[h] >> 4, rows[h] & 15]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [rows[0]] + [nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2)]
+
+
+def unpack_rows(data):
+    rows = [data[0]]
+    nibbles = []
+    for byte in data[1:]:
+        nibbles += [byte & 15, byte >> 4]
+    i = 0
+    while len(rows) <= HALF_WIDTH:
+        if nibbles[i] == 15:
+            rows.append((nibbles[i + 1] << 4) | nibbles[i + 2])
+            i += 3
+        else:
+            rows.append(rows[-1] - nibbles[i])
+            i += 1
+    return rows
+
+
+def profile_column(sin_decl, rows_lo, rows_hi, column):
+    """Integer-exact copy of update_profile() in src/render.c. Returns the
+    set of night rows for a column of hour angle."""
+    pos = abs(sin_decl) * (BUCKETS - 1)
+    frac = pos % SIN_MAX
+    h = MAP_WIDTH - column if column > HALF_WIDTH else column
+    r = (rows_lo[h] * (SIN_MAX - frac) + rows_hi[h] * frac + SIN_MAX // 2) // SIN_MAX
+
+    if sin_decl <= 0:
+        return set(range(min(r, MAP_HEIGHT)))
+    return set(range(max(MAP_HEIGHT + 1 - r, 0), MAP_HEIGHT))
+
+
+def format_array(ctype, name, values, per_line=24):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(','.join(str(v) for v in values[i:i + per_line]))
+    return 'const %s %s[] = {\n%s\n};\n' % (ctype, name, ',\n'.join(lines))
+
+
+def main():
+    projection = sys.argv[3] if len(sys.argv) > 3 else 'mercator'
+    set_map_size(int(sys.argv[1]), int(sys.argv[2]), projection)
+    assert MAP_WIDTH % 4 == 0 and MAP_WIDTH < 256 and MAP_HEIGHT % 2 == 0 and MAP_HEIGHT < 255
+    packed = [pack_rows(bucket_rows(b)) for b in range(1, BUCKETS)]
+    offsets = []
+    data = []
+    for p in packed:
+        offsets.append(len(data))
+        data += p
+
+    # Measure the table against the exact terminator, decoding it the same
+    # way the watch does, on the days it's used
+    unpacked = [None] + [unpack_rows(p) for p in packed]
+    days = 0
+    max_row_error = 0
+    total_error = 0
+    for day in range(gen_ephemeris_table.DAYS):
+        declination, _ = gen_ephemeris_table.sun_position(
+            gen_ephemeris_table.julian_day(gen_ephemeris_table.REFERENCE_YEAR, day))
+        sin_decl = gen_ephemeris_table.day_entry(day)[0]
+        assert abs(sin_decl) <= SIN_MAX
+        bucket = abs(sin_decl) * (BUCKETS - 1) // SIN_MAX
+        if bucket == 0:
+            continue
+        days += 1
+        rows_lo = unpacked[bucket]
+        rows_hi = unpacked[min(bucket + 1, BUCKETS - 1)]
+        for column in range(MAP_WIDTH):
+            error = len(profile_column(sin_decl, rows_lo, rows_hi, column) ^
+                        float_model_night(declination, column))
+            max_row_error = max(max_row_error, error)
+            total_error += error
+
+    size = len(data) + 2 * len(offsets)
+    sys.stderr.write('terminator table: %d bytes (%d packed rows, %d offsets)\n' %
+                     (size, len(data), 2 * len(offsets)))
+    sys.stderr.write('max row error: %d rows, mean %.3f rows per column, %.4f%% of pixels, '
+                     'over the %d days not scanned\n' %
+                     (max_row_error, float(total_error) / (days * MAP_WIDTH),
+                      100.0 * total_error / (days * MAP_WIDTH * MAP_HEIGHT), days))
+
+    out = sys.stdout
+    out.write('// Precomputed day/night terminator for a %dx%d %s map. Generated by\n' %
+              (MAP_WIDTH, MAP_HEIGHT, projection))
+    out.write('// tools/gen_terminator_table.py, do not edit.\n\n')
+    out.write('#define TERMINATOR_BUCKETS %d\n' % BUCKETS)
+    out.write('#define TERMINATOR_SIN_MAX %d\n\n' % SIN_MAX)
+    out.write('// Packed night rows per declination bucket from bucket 1, see\n')
+    out.write('// decode_terminator_rows()\n')
+    out.write(format_array('uint16_t', 'TERMINATOR_OFFSETS', offsets))
+    out.write(format_array('uint8_t', 'TERMINATOR_ROWS', data))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,76 @@
+// The driver's side of tools/host/pebble_host.c: the timeline of events the
+// app is run against, and hooks for what it draws and logs.
+
+#pragma once
+
+#include "map_config.h"
+#include "pebble.h"
+
+// The frame buffer: SCREEN_HEIGHT rows of whole words, as on the watch
+#define HOST_ROW_BYTES (((SCREEN_WIDTH + 31) >> 5) * 4)
+
+// Non-fullscreen windows lose this many rows at the top to the status bar
+#define HOST_STATUS_BAR_HEIGHT 16
+
+// Events, in order of time. A button press is handled as the watch's click
+// recognisers would, up to its release: the single click on the press (or on
+// the release, if the button also has a long click), then repeats or the long
+// click while it's held.
+#define HOST_PRESS    0   // value: ButtonId
+#define HOST_RELEASE  1   // value: ButtonId
+#define HOST_BATTERY  2   // value: charge percent
+#define HOST_CHARGING 3   // value: 1 plugged in and charging, 0 not
+#define HOST_FOCUS    4   // value: 1 in focus, 0 covered by a notification
+#define HOST_QUIT     5   // close every window and leave the event loop
+
+typedef struct {
+    // ms from the start
+    uint32_t time;
+    uint8_t type;
+    int16_t value;
+} HostEvent;
+
+typedef struct {
+    // Local time at the start
+    time_t start;
+    // Virtual ms that pass per ms of host CPU time the app spends in its
+    // callbacks. At 0 they take no time, and a run is deterministic.
+    double cpu_scale;
+    int clock_24h;
+    const char *land_map_path;
+
+    const HostEvent *events;
+    int event_count;
+
+    // Hooks, any of which can be 0. frame is called after each redraw with
+    // the frame buffer and the host time the redraw took; event just before
+    // an event is handled.
+    void (*frame)(const uint8_t *pixels, uint32_t time, long long cost_ns);
+    void (*event)(const HostEvent *event, uint32_t time);
+    void (*text)(const char *text, GRect box);
+    void (*log)(uint32_t time, const char *message);
+} HostConfig;
+
+typedef struct {
+    int frames;
+    // Timer and tick callbacks, each of which would wake the watch
+    int wakeups;
+    int persist_writes;
+    int persist_bytes;
+    int vibes;
+} HostStats;
+
+extern HostConfig g_host;
+extern HostStats g_host_stats;
+
+// Virtual ms since the start
+uint32_t host_now();
+
+// Persistent storage as a file of records: uint32 key, uint16 length, data,
+// little-endian. Return -1 on failure; a file that doesn't exist is empty
+// storage.
+int host_load_persist(const char *path);
+int host_save_persist(const char *path);
+
+// The app's main(), built with -Dmain=app_main
+int app_main(void);
@@ -0,0 +1,256 @@
+// Stand-in for the Pebble SDK 2 header on a Linux host: the part of the API
+// the app uses, with the same names and signatures, so src/pebble-worldmap.c,
+// src/settings.c and src/frame_cache.c build unmodified against it. It's
+// implemented by tools/host/pebble_host.c, which runs the app against a
+// scripted timeline of events (see tools/sim.c).
+//
+// time() and localtime() are the host's virtual clock, which like the watch's
+// keeps local time, so they are macros here.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Geometry
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+} GPoint;
+
+typedef struct {
+    int16_t w;
+    int16_t h;
+} GSize;
+
+typedef struct {
+    GPoint origin;
+    GSize size;
+} GRect;
+
+#define GPoint(x, y) ((GPoint){(x), (y)})
+#define GSize(w, h) ((GSize){(w), (h)})
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+
+// Graphics
+
+typedef enum {
+    GColorClear = ~0,
+    GColorBlack = 0,
+    GColorWhite = 1
+} GColor;
+
+typedef enum {
+    GCornerNone = 0,
+    GCornerTopLeft = 1 << 0,
+    GCornerTopRight = 1 << 1,
+    GCornerBottomLeft = 1 << 2,
+    GCornerBottomRight = 1 << 3,
+    GCornersAll = 0xF
+} GCornerMask;
+
+typedef enum {
+    GTextOverflowModeWordWrap,
+    GTextOverflowModeTrailingEllipsis,
+    GTextOverflowModeFill
+} GTextOverflowMode;
+
+typedef enum {
+    GTextAlignmentLeft,
+    GTextAlignmentCenter,
+    GTextAlignmentRight
+} GTextAlignment;
+
+// 1 bit per pixel, the leftmost pixel of each byte in its low bit and 1 for
+// white; rows are row_size_bytes apart
+typedef struct {
+    void *addr;
+    uint16_t row_size_bytes;
+    uint16_t info_flags;
+    GRect bounds;
+} GBitmap;
+
+typedef struct GContext GContext;
+typedef const char *GFont;
+typedef void *GTextLayoutCacheRef;
+
+#define FONT_KEY_FONT_FALLBACK "RESOURCE_ID_FONT_FALLBACK"
+#define FONT_KEY_GOTHIC_14 "RESOURCE_ID_GOTHIC_14"
+#define FONT_KEY_GOTHIC_14_BOLD "RESOURCE_ID_GOTHIC_14_BOLD"
+#define FONT_KEY_GOTHIC_18 "RESOURCE_ID_GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD "RESOURCE_ID_GOTHIC_18_BOLD"
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect);
+GBitmap *graphics_capture_frame_buffer(GContext *ctx);
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+
+// Text isn't rasterised; each call is passed to the host's text hook, with
+// the box it would be drawn in
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+        const GTextLayoutCacheRef layout);
+GFont fonts_get_system_font(const char *font_key);
+
+// Windows and layers
+
+typedef struct Window Window;
+typedef struct Layer Layer;
+
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+typedef void (*WindowHandler)(Window *window);
+
+typedef struct {
+    WindowHandler load;
+    WindowHandler appear;
+    WindowHandler disappear;
+    WindowHandler unload;
+} WindowHandlers;
+
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_fullscreen(Window *window, bool enabled);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+Layer *window_get_root_layer(const Window *window);
+void window_stack_push(Window *window, bool animated);
+Window *window_stack_pop(bool animated);
+Window *window_stack_get_top_window(void);
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void layer_mark_dirty(Layer *layer);
+GRect layer_get_frame(const Layer *layer);
+void layer_set_frame(Layer *layer, GRect frame);
+GRect layer_get_bounds(const Layer *layer);
+
+// Clicks
+
+typedef enum {
+    BUTTON_ID_BACK = 0,
+    BUTTON_ID_UP,
+    BUTTON_ID_SELECT,
+    BUTTON_ID_DOWN,
+    NUM_BUTTONS
+} ButtonId;
+
+typedef void *ClickRecognizerRef;
+typedef void (*ClickHandler)(ClickRecognizerRef recognizer, void *context);
+typedef void (*ClickConfigProvider)(void *context);
+
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider);
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler);
+void window_single_repeating_click_subscribe(ButtonId button_id, uint16_t repeat_interval_ms,
+        ClickHandler handler);
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+        ClickHandler down_handler, ClickHandler up_handler);
+void window_raw_click_subscribe(ButtonId button_id, ClickHandler down_handler,
+        ClickHandler up_handler, void *context);
+ButtonId click_recognizer_get_button_id(ClickRecognizerRef recognizer);
+
+// Animation
+
+typedef struct Animation Animation;
+typedef struct PropertyAnimation PropertyAnimation;
+
+PropertyAnimation *property_animation_create_layer_frame(Layer *layer, GRect *from_frame,
+        GRect *to_frame);
+void property_animation_destroy(PropertyAnimation *property_animation);
+void animation_set_duration(Animation *animation, uint32_t duration_ms);
+void animation_schedule(Animation *animation);
+void animation_unschedule(Animation *animation);
+
+// Timers and the event loop
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms);
+void app_timer_cancel(AppTimer *timer_handle);
+
+void app_event_loop(void);
+
+// Time
+
+typedef enum {
+    SECOND_UNIT = 1 << 0,
+    MINUTE_UNIT = 1 << 1,
+    HOUR_UNIT = 1 << 2,
+    DAY_UNIT = 1 << 3,
+    MONTH_UNIT = 1 << 4,
+    YEAR_UNIT = 1 << 5
+} TimeUnits;
+
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+
+time_t host_time(time_t *tloc);
+struct tm *host_localtime(const time_t *timep);
+#define time(tloc) host_time(tloc)
+#define localtime(timep) host_localtime(timep)
+
+uint16_t time_ms(time_t *t_utc, uint16_t *out_ms);
+bool clock_is_24h_style(void);
+
+// Services
+
+typedef struct {
+    uint8_t charge_percent;
+    bool is_charging;
+    bool is_plugged;
+} BatteryChargeState;
+
+typedef void (*AppFocusHandler)(bool in_focus);
+
+BatteryChargeState battery_state_service_peek(void);
+void app_focus_service_subscribe(AppFocusHandler handler);
+void app_focus_service_unsubscribe(void);
+void vibes_short_pulse(void);
+
+// Persistent storage
+
+typedef int32_t status_t;
+
+#define S_SUCCESS 0
+#define E_DOES_NOT_EXIST -9
+#define PERSIST_DATA_MAX_LENGTH 256
+
+bool persist_exists(const uint32_t key);
+int32_t persist_read_int(const uint32_t key);
+status_t persist_write_int(const uint32_t key, const int32_t value);
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size);
+int persist_write_data(const uint32_t key, const void *data, const size_t size);
+status_t persist_delete(const uint32_t key);
+
+// Resources, from appinfo.json
+
+typedef const uint8_t *ResHandle;
+
+#define RESOURCE_ID_WORLD_MAP 1
+
+ResHandle resource_get_handle(uint32_t resource_id);
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer,
+        size_t num_bytes);
+
+// Logging
+
+typedef enum {
+    APP_LOG_LEVEL_ERROR = 1,
+    APP_LOG_LEVEL_WARNING = 50,
+    APP_LOG_LEVEL_INFO = 100,
+    APP_LOG_LEVEL_DEBUG = 200,
+    APP_LOG_LEVEL_DEBUG_VERBOSE = 255
+} AppLogLevel;
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number,
+        const char *fmt, ...) __attribute__((format(printf, 4, 5)));
+
+#define APP_LOG(level, fmt, ...) app_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
@@ -0,0 +1,1039 @@
+// The host's stand-in for the Pebble SDK (see pebble.h), which runs the app
+// on a virtual clock. The clock only moves when app_event_loop() goes on to
+// whatever is due next: a scripted event, a held button, an app timer, an
+// animation frame or a tick. With a CPU scale it also moves while the app's
+// code runs, so render_slice() sees its time budget pass. After anything the
+// app handles, the top window is redrawn into the frame buffer if it's dirty,
+// as the watch does at the end of each event.
+
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "host.h"
+
+#undef time
+#undef localtime
+
+#define NEVER 0xFFFFFFFF
+
+// Animations step at about the display's rate
+#define ANIMATION_FRAME_MS 33
+
+// A long click fires after this long by default
+#define LONG_CLICK_MS 500
+
+#define MAX_WINDOWS 8
+#define MAX_TIMERS 64
+#define MAX_ANIMATIONS 32
+#define MAX_RECORDS 256
+#define MAX_RESOURCE 16384
+
+HostConfig g_host = {
+    .clock_24h = 1,
+};
+HostStats g_host_stats;
+
+// Virtual ms since the start
+uint32_t g_now = 0;
+
+// Host time when the app's code was entered, and how deeply, for the CPU
+// scale
+long long g_app_entered = 0;
+int g_app_depth = 0;
+
+long long host_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+uint32_t host_now() {
+    if (g_app_depth > 0 && g_host.cpu_scale > 0) {
+        return g_now + (uint32_t)((host_ns() - g_app_entered) * g_host.cpu_scale / 1e6);
+    }
+    return g_now;
+}
+
+// Bracket a call into the app. leave_app() returns the host time it took,
+// and charges it to the virtual clock.
+void enter_app() {
+    if (g_app_depth++ == 0) {
+        g_app_entered = host_ns();
+    }
+}
+
+long long leave_app() {
+    long long ns = host_ns() - g_app_entered;
+    if (g_app_depth == 1) {
+        g_now = host_now();
+    }
+    g_app_depth--;
+    return ns;
+}
+
+/* Graphics */
+
+struct GContext {
+    GColor fill_color;
+    GColor text_color;
+    // Screen position of the layer being drawn, and the screen area it can
+    // draw in
+    GPoint offset;
+    GRect clip;
+};
+
+uint32_t g_frame_buffer[SCREEN_HEIGHT * HOST_ROW_BYTES / 4];
+GBitmap g_frame_bitmap = {
+    .addr = g_frame_buffer,
+    .row_size_bytes = HOST_ROW_BYTES,
+    .bounds = {{0, 0}, {SCREEN_WIDTH, SCREEN_HEIGHT}}
+};
+
+GRect intersect(GRect a, GRect b) {
+    int x0 = (a.origin.x > b.origin.x) ? a.origin.x : b.origin.x;
+    int y0 = (a.origin.y > b.origin.y) ? a.origin.y : b.origin.y;
+    int x1 = (a.origin.x + a.size.w < b.origin.x + b.size.w) ? a.origin.x + a.size.w : b.origin.x + b.size.w;
+    int y1 = (a.origin.y + a.size.h < b.origin.y + b.size.h) ? a.origin.y + a.size.h : b.origin.y + b.size.h;
+    return GRect(x0, y0, (x1 > x0) ? x1 - x0 : 0, (y1 > y0) ? y1 - y0 : 0);
+}
+
+// A rect in the layer's coordinates, on the screen and clipped
+GRect to_screen(GContext *ctx, GRect rect) {
+    rect.origin.x += ctx->offset.x;
+    rect.origin.y += ctx->offset.y;
+    return intersect(rect, ctx->clip);
+}
+
+int get_pixel(const GBitmap *bitmap, int x, int y) {
+    const uint8_t *row = (const uint8_t *)bitmap->addr + y * bitmap->row_size_bytes;
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+void set_pixel(int x, int y, int white) {
+    uint8_t *byte = (uint8_t *)g_frame_buffer + y * HOST_ROW_BYTES + (x >> 3);
+    if (white) {
+        *byte |= 1 << (x & 7);
+    } else {
+        *byte &= ~(1 << (x & 7));
+    }
+}
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color) {
+    ctx->fill_color = color;
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color) {
+    ctx->text_color = color;
+}
+
+// Corners are left square
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {
+    GRect area = to_screen(ctx, rect);
+    int x, y;
+    (void)corner_radius;
+    (void)corner_mask;
+
+    if (ctx->fill_color == GColorClear) {
+        return;
+    }
+    for (y = area.origin.y; y < area.origin.y + area.size.h; y++) {
+        for (x = area.origin.x; x < area.origin.x + area.size.w; x++) {
+            set_pixel(x, y, ctx->fill_color == GColorWhite);
+        }
+    }
+}
+
+// The bitmap is tiled if the rect is bigger than it
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect) {
+    GRect area = to_screen(ctx, rect);
+    int left = rect.origin.x + ctx->offset.x;
+    int top = rect.origin.y + ctx->offset.y;
+    int x, y;
+
+    for (y = area.origin.y; y < area.origin.y + area.size.h; y++) {
+        int sy = bitmap->bounds.origin.y + (y - top) % bitmap->bounds.size.h;
+        for (x = area.origin.x; x < area.origin.x + area.size.w; x++) {
+            int sx = bitmap->bounds.origin.x + (x - left) % bitmap->bounds.size.w;
+            set_pixel(x, y, get_pixel(bitmap, sx, sy));
+        }
+    }
+}
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx) {
+    (void)ctx;
+    return &g_frame_bitmap;
+}
+
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer) {
+    (void)ctx;
+    return buffer == &g_frame_bitmap;
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+        const GTextLayoutCacheRef layout) {
+    GRect on_screen = box;
+    (void)font;
+    (void)overflow_mode;
+    (void)alignment;
+    (void)layout;
+
+    on_screen.origin.x += ctx->offset.x;
+    on_screen.origin.y += ctx->offset.y;
+    if (g_host.text) {
+        g_host.text(text, on_screen);
+    }
+}
+
+GFont fonts_get_system_font(const char *font_key) {
+    return font_key;
+}
+
+/* Clicks */
+
+// A button's click configuration in the top window, and its state while it's
+// held. A ClickRecognizerRef points at one of these.
+typedef struct {
+    ClickHandler single;
+    uint16_t repeat_ms;
+    ClickHandler long_down;
+    ClickHandler long_up;
+    uint16_t long_ms;
+    ClickHandler raw_down;
+    ClickHandler raw_up;
+    void *raw_context;
+
+    int held;
+    int long_fired;
+    uint32_t next_repeat;
+    uint32_t long_due;
+} Button;
+
+Button g_buttons[NUM_BUTTONS];
+
+int has_long_click(const Button *button) {
+    return button->long_down || button->long_up;
+}
+
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler) {
+    g_buttons[button_id].single = handler;
+    g_buttons[button_id].repeat_ms = 0;
+}
+
+void window_single_repeating_click_subscribe(ButtonId button_id, uint16_t repeat_interval_ms,
+        ClickHandler handler) {
+    g_buttons[button_id].single = handler;
+    g_buttons[button_id].repeat_ms = repeat_interval_ms;
+}
+
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+        ClickHandler down_handler, ClickHandler up_handler) {
+    g_buttons[button_id].long_down = down_handler;
+    g_buttons[button_id].long_up = up_handler;
+    g_buttons[button_id].long_ms = delay_ms ? delay_ms : LONG_CLICK_MS;
+}
+
+void window_raw_click_subscribe(ButtonId button_id, ClickHandler down_handler,
+        ClickHandler up_handler, void *context) {
+    g_buttons[button_id].raw_down = down_handler;
+    g_buttons[button_id].raw_up = up_handler;
+    g_buttons[button_id].raw_context = context;
+}
+
+ButtonId click_recognizer_get_button_id(ClickRecognizerRef recognizer) {
+    return (ButtonId)((Button *)recognizer - g_buttons);
+}
+
+/* Windows and layers */
+
+struct Layer {
+    GRect frame;
+    LayerUpdateProc update_proc;
+    Window *window;
+};
+
+struct Window {
+    Layer root;
+    int fullscreen;
+    int loaded;
+    int dirty;
+    WindowHandlers handlers;
+    ClickConfigProvider click_config_provider;
+};
+
+Window *g_stack[MAX_WINDOWS];
+int g_stack_size = 0;
+
+Window *window_stack_get_top_window(void) {
+    return g_stack_size ? g_stack[g_stack_size - 1] : NULL;
+}
+
+void call_window_handler(Window *window, WindowHandler handler) {
+    if (handler) {
+        enter_app();
+        handler(window);
+        leave_app();
+    }
+}
+
+// Set up the buttons for the window now on top; any that are held are
+// forgotten, as their recognisers are gone
+void configure_clicks(Window *window) {
+    memset(g_buttons, 0, sizeof(g_buttons));
+    if (window->click_config_provider) {
+        enter_app();
+        window->click_config_provider(window);
+        leave_app();
+    }
+}
+
+Window *window_create(void) {
+    Window *window = calloc(1, sizeof(Window));
+    window->root.frame = GRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT - HOST_STATUS_BAR_HEIGHT);
+    window->root.window = window;
+    return window;
+}
+
+void window_destroy(Window *window) {
+    free(window);
+}
+
+void window_set_fullscreen(Window *window, bool enabled) {
+    window->fullscreen = enabled;
+    window->root.frame.size.h = SCREEN_HEIGHT - (enabled ? 0 : HOST_STATUS_BAR_HEIGHT);
+    window->dirty = 1;
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+    window->handlers = handlers;
+}
+
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider) {
+    window->click_config_provider = click_config_provider;
+    if (window == window_stack_get_top_window()) {
+        configure_clicks(window);
+    }
+}
+
+Layer *window_get_root_layer(const Window *window) {
+    return (Layer *)&window->root;
+}
+
+void window_stack_push(Window *window, bool animated) {
+    Window *top = window_stack_get_top_window();
+    (void)animated;
+
+    if (window == top || g_stack_size == MAX_WINDOWS) {
+        return;
+    }
+    if (top) {
+        call_window_handler(top, top->handlers.disappear);
+    }
+    g_stack[g_stack_size++] = window;
+    if (!window->loaded) {
+        window->loaded = 1;
+        call_window_handler(window, window->handlers.load);
+    }
+    call_window_handler(window, window->handlers.appear);
+    configure_clicks(window);
+    window->dirty = 1;
+}
+
+Window *window_stack_pop(bool animated) {
+    Window *window, *top;
+    (void)animated;
+
+    if (!g_stack_size) {
+        return NULL;
+    }
+    window = g_stack[--g_stack_size];
+    call_window_handler(window, window->handlers.disappear);
+    window->loaded = 0;
+    call_window_handler(window, window->handlers.unload);
+
+    top = window_stack_get_top_window();
+    if (top) {
+        call_window_handler(top, top->handlers.appear);
+        configure_clicks(top);
+        top->dirty = 1;
+    }
+    return window;
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+    layer->update_proc = update_proc;
+}
+
+void layer_mark_dirty(Layer *layer) {
+    layer->window->dirty = 1;
+}
+
+GRect layer_get_frame(const Layer *layer) {
+    return layer->frame;
+}
+
+void layer_set_frame(Layer *layer, GRect frame) {
+    layer->frame = frame;
+    layer->window->dirty = 1;
+}
+
+GRect layer_get_bounds(const Layer *layer) {
+    return GRect(0, 0, layer->frame.size.w, layer->frame.size.h);
+}
+
+// Draw the top window if it's dirty: white, under the status bar if it has
+// one, then its root layer
+void redraw() {
+    Window *window = window_stack_get_top_window();
+    GContext ctx = {GColorWhite, GColorBlack};
+    int top;
+    long long cost;
+
+    if (!window || !window->dirty) {
+        return;
+    }
+    window->dirty = 0;
+
+    top = window->fullscreen ? 0 : HOST_STATUS_BAR_HEIGHT;
+    memset(g_frame_buffer, 0, top * HOST_ROW_BYTES);
+    memset((uint8_t *)g_frame_buffer + top * HOST_ROW_BYTES, 0xFF,
+            (SCREEN_HEIGHT - top) * HOST_ROW_BYTES);
+
+    ctx.offset = GPoint(window->root.frame.origin.x, window->root.frame.origin.y + top);
+    ctx.clip = intersect(GRect(ctx.offset.x, ctx.offset.y, window->root.frame.size.w,
+            window->root.frame.size.h), GRect(0, top, SCREEN_WIDTH, SCREEN_HEIGHT - top));
+
+    enter_app();
+    if (window->root.update_proc) {
+        window->root.update_proc(&window->root, &ctx);
+    }
+    cost = leave_app();
+
+    g_host_stats.frames++;
+    if (g_host.frame) {
+        g_host.frame((const uint8_t *)g_frame_buffer, g_now, cost);
+    }
+}
+
+/* Animation */
+
+// Finished animations go back to the pool, as an SDK 2 app doesn't destroy
+// them
+struct PropertyAnimation {
+    int in_use;
+    int scheduled;
+    Layer *layer;
+    GRect from;
+    GRect to;
+    uint32_t duration;
+    uint32_t start;
+};
+
+struct PropertyAnimation g_animations[MAX_ANIMATIONS];
+uint32_t g_next_animation_frame = NEVER;
+
+PropertyAnimation *property_animation_create_layer_frame(Layer *layer, GRect *from_frame,
+        GRect *to_frame) {
+    int i;
+    for (i = 0; i < MAX_ANIMATIONS; i++) {
+        PropertyAnimation *animation = &g_animations[i];
+        if (!animation->in_use) {
+            memset(animation, 0, sizeof(*animation));
+            animation->in_use = 1;
+            animation->layer = layer;
+            animation->from = from_frame ? *from_frame : layer->frame;
+            animation->to = to_frame ? *to_frame : layer->frame;
+            animation->duration = 250;
+            return animation;
+        }
+    }
+    return NULL;
+}
+
+void property_animation_destroy(PropertyAnimation *property_animation) {
+    if (property_animation) {
+        property_animation->in_use = 0;
+    }
+}
+
+void animation_set_duration(Animation *animation, uint32_t duration_ms) {
+    if (animation) {
+        ((PropertyAnimation *)animation)->duration = duration_ms;
+    }
+}
+
+void animation_schedule(Animation *animation) {
+    PropertyAnimation *property = (PropertyAnimation *)animation;
+    if (!property) {
+        return;
+    }
+    property->scheduled = 1;
+    property->start = g_now;
+    if (g_next_animation_frame == NEVER) {
+        g_next_animation_frame = g_now + ANIMATION_FRAME_MS;
+    }
+}
+
+void animation_unschedule(Animation *animation) {
+    if (animation) {
+        ((PropertyAnimation *)animation)->scheduled = 0;
+    }
+}
+
+int lerp(int from, int to, int progress) {
+    return from + (int)(((int64_t)(to - from) * progress + 32768) >> 16);
+}
+
+// Move every scheduled animation on to now, easing in and out like the
+// SDK's default curve
+void step_animations() {
+    int i, running = 0;
+    for (i = 0; i < MAX_ANIMATIONS; i++) {
+        PropertyAnimation *animation = &g_animations[i];
+        int64_t t;
+        int progress;
+        GRect frame;
+
+        if (!animation->in_use || !animation->scheduled) {
+            continue;
+        }
+        t = animation->duration ? ((int64_t)(g_now - animation->start) << 16) / animation->duration : 65536;
+        if (t >= 65536) {
+            progress = 65536;
+        } else if (t < 32768) {
+            progress = (int)((t * t) >> 15);
+        } else {
+            progress = 65536 - (int)(((65536 - t) * (65536 - t)) >> 15);
+        }
+
+        frame.origin.x = lerp(animation->from.origin.x, animation->to.origin.x, progress);
+        frame.origin.y = lerp(animation->from.origin.y, animation->to.origin.y, progress);
+        frame.size.w = lerp(animation->from.size.w, animation->to.size.w, progress);
+        frame.size.h = lerp(animation->from.size.h, animation->to.size.h, progress);
+        layer_set_frame(animation->layer, frame);
+
+        if (progress == 65536) {
+            animation->in_use = 0;
+        } else {
+            running = 1;
+        }
+    }
+    g_next_animation_frame = running ? g_now + ANIMATION_FRAME_MS : NEVER;
+}
+
+/* Timers */
+
+// Handles are IDs, which aren't reused, so a stale one is just not found
+typedef struct {
+    uint32_t id;
+    uint32_t due;
+    AppTimerCallback callback;
+    void *data;
+} Timer;
+
+Timer g_timers[MAX_TIMERS];
+uint32_t g_next_timer_id = 1;
+
+Timer *find_timer(AppTimer *timer_handle) {
+    uint32_t id = (uint32_t)(uintptr_t)timer_handle;
+    int i;
+    for (i = 0; id && i < MAX_TIMERS; i++) {
+        if (g_timers[i].id == id) {
+            return &g_timers[i];
+        }
+    }
+    return NULL;
+}
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+    Timer *timer = NULL;
+    int i;
+    for (i = 0; !timer && i < MAX_TIMERS; i++) {
+        if (!g_timers[i].id) {
+            timer = &g_timers[i];
+        }
+    }
+    if (!timer) {
+        return NULL;
+    }
+    timer->id = g_next_timer_id++;
+    timer->due = host_now() + timeout_ms;
+    timer->callback = callback;
+    timer->data = callback_data;
+    return (AppTimer *)(uintptr_t)timer->id;
+}
+
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms) {
+    Timer *timer = find_timer(timer_handle);
+    if (!timer) {
+        return false;
+    }
+    timer->due = host_now() + new_timeout_ms;
+    return true;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+    Timer *timer = find_timer(timer_handle);
+    if (timer) {
+        timer->id = 0;
+    }
+}
+
+// The timer due first, ties going to the one registered first
+Timer *next_timer() {
+    Timer *next = NULL;
+    int i;
+    for (i = 0; i < MAX_TIMERS; i++) {
+        Timer *timer = &g_timers[i];
+        if (timer->id && (!next || timer->due < next->due ||
+                (timer->due == next->due && timer->id < next->id))) {
+            next = timer;
+        }
+    }
+    return next;
+}
+
+/* Time */
+
+time_t host_time(time_t *tloc) {
+    time_t t = g_host.start + host_now() / 1000;
+    if (tloc) {
+        *tloc = t;
+    }
+    return t;
+}
+
+// The watch keeps local time, so there's no conversion
+struct tm *host_localtime(const time_t *timep) {
+    static struct tm result;
+    return gmtime_r(timep, &result);
+}
+
+uint16_t time_ms(time_t *t_utc, uint16_t *out_ms) {
+    uint32_t now = host_now();
+    if (t_utc) {
+        *t_utc = g_host.start + now / 1000;
+    }
+    if (out_ms) {
+        *out_ms = now % 1000;
+    }
+    return now % 1000;
+}
+
+bool clock_is_24h_style(void) {
+    return g_host.clock_24h;
+}
+
+TickHandler g_tick_handler = NULL;
+TimeUnits g_tick_units = 0;
+struct tm g_last_tick;
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+    time_t now = host_time(NULL);
+    g_tick_handler = handler;
+    g_tick_units = tick_units;
+    gmtime_r(&now, &g_last_tick);
+}
+
+void tick_timer_service_unsubscribe(void) {
+    g_tick_handler = NULL;
+}
+
+// The start of the next second, minute, hour or day, whichever is the
+// smallest unit subscribed to; months and years change on a day
+uint32_t next_tick() {
+    time_t now = g_host.start + g_now / 1000;
+    int period = (g_tick_units & SECOND_UNIT) ? 1 : (g_tick_units & MINUTE_UNIT) ? 60 :
+        (g_tick_units & HOUR_UNIT) ? 3600 : 86400;
+    if (!g_tick_handler || !g_tick_units) {
+        return NEVER;
+    }
+    return (uint32_t)((now / period + 1) * period - g_host.start) * 1000;
+}
+
+void tick() {
+    time_t now = host_time(NULL);
+    struct tm tick_time;
+    TimeUnits changed = SECOND_UNIT;
+
+    gmtime_r(&now, &tick_time);
+    if (tick_time.tm_min != g_last_tick.tm_min || tick_time.tm_hour != g_last_tick.tm_hour ||
+            tick_time.tm_yday != g_last_tick.tm_yday) changed |= MINUTE_UNIT;
+    if (tick_time.tm_hour != g_last_tick.tm_hour || tick_time.tm_yday != g_last_tick.tm_yday) changed |= HOUR_UNIT;
+    if (tick_time.tm_yday != g_last_tick.tm_yday || tick_time.tm_year != g_last_tick.tm_year) changed |= DAY_UNIT;
+    if (tick_time.tm_mon != g_last_tick.tm_mon) changed |= MONTH_UNIT;
+    if (tick_time.tm_year != g_last_tick.tm_year) changed |= YEAR_UNIT;
+    g_last_tick = tick_time;
+
+    if (changed & g_tick_units) {
+        g_host_stats.wakeups++;
+        enter_app();
+        g_tick_handler(&tick_time, changed);
+        leave_app();
+    }
+}
+
+/* Services */
+
+BatteryChargeState g_battery = {100, false, false};
+AppFocusHandler g_focus_handler = NULL;
+
+BatteryChargeState battery_state_service_peek(void) {
+    return g_battery;
+}
+
+void app_focus_service_subscribe(AppFocusHandler handler) {
+    g_focus_handler = handler;
+}
+
+void app_focus_service_unsubscribe(void) {
+    g_focus_handler = NULL;
+}
+
+void vibes_short_pulse(void) {
+    g_host_stats.vibes++;
+    if (g_host.log) {
+        g_host.log(g_now, "vibe");
+    }
+}
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number,
+        const char *fmt, ...) {
+    char message[256];
+    va_list args;
+    (void)log_level;
+    (void)src_filename;
+    (void)src_line_number;
+
+    if (!g_host.log) {
+        return;
+    }
+    va_start(args, fmt);
+    vsnprintf(message, sizeof(message), fmt, args);
+    va_end(args);
+    g_host.log(g_now, message);
+}
+
+/* Persistent storage */
+
+typedef struct {
+    int used;
+    uint32_t key;
+    uint16_t length;
+    uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} Record;
+
+Record g_records[MAX_RECORDS];
+
+Record *find_record(uint32_t key, int create) {
+    Record *free_record = NULL;
+    int i;
+    for (i = 0; i < MAX_RECORDS; i++) {
+        if (g_records[i].used && g_records[i].key == key) {
+            return &g_records[i];
+        }
+        if (!g_records[i].used && !free_record) {
+            free_record = &g_records[i];
+        }
+    }
+    if (create && free_record) {
+        free_record->used = 1;
+        free_record->key = key;
+        free_record->length = 0;
+        return free_record;
+    }
+    return NULL;
+}
+
+bool persist_exists(const uint32_t key) {
+    return find_record(key, 0) != NULL;
+}
+
+int32_t persist_read_int(const uint32_t key) {
+    int32_t value = 0;
+    persist_read_data(key, &value, sizeof(value));
+    return value;
+}
+
+status_t persist_write_int(const uint32_t key, const int32_t value) {
+    int written = persist_write_data(key, &value, sizeof(value));
+    return (written < 0) ? written : S_SUCCESS;
+}
+
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size) {
+    Record *record = find_record(key, 0);
+    int length;
+    if (!record) {
+        return E_DOES_NOT_EXIST;
+    }
+    length = (record->length < buffer_size) ? record->length : (int)buffer_size;
+    memcpy(buffer, record->data, length);
+    return length;
+}
+
+int persist_write_data(const uint32_t key, const void *data, const size_t size) {
+    Record *record = find_record(key, 1);
+    int length = (size < PERSIST_DATA_MAX_LENGTH) ? (int)size : PERSIST_DATA_MAX_LENGTH;
+    if (!record) {
+        return -1;
+    }
+    memcpy(record->data, data, length);
+    record->length = length;
+    g_host_stats.persist_writes++;
+    g_host_stats.persist_bytes += length;
+    return length;
+}
+
+status_t persist_delete(const uint32_t key) {
+    Record *record = find_record(key, 0);
+    if (!record) {
+        return E_DOES_NOT_EXIST;
+    }
+    record->used = 0;
+    return S_SUCCESS;
+}
+
+int host_load_persist(const char *path) {
+    FILE *f = fopen(path, "rb");
+    uint8_t header[6];
+
+    memset(g_records, 0, sizeof(g_records));
+    if (!f) {
+        return 0;
+    }
+    while (fread(header, 1, sizeof(header), f) == sizeof(header)) {
+        uint32_t key = header[0] | header[1] << 8 | header[2] << 16 | (uint32_t)header[3] << 24;
+        int length = header[4] | header[5] << 8;
+        Record *record = find_record(key, 1);
+        if (!record || length > PERSIST_DATA_MAX_LENGTH ||
+                fread(record->data, 1, length, f) != (size_t)length) {
+            fclose(f);
+            return -1;
+        }
+        record->length = length;
+    }
+    fclose(f);
+    return 0;
+}
+
+int host_save_persist(const char *path) {
+    FILE *f = fopen(path, "wb");
+    int i;
+
+    if (!f) {
+        return -1;
+    }
+    for (i = 0; i < MAX_RECORDS; i++) {
+        Record *record = &g_records[i];
+        uint8_t header[6] = {
+            record->key & 0xFF, (record->key >> 8) & 0xFF, (record->key >> 16) & 0xFF,
+            record->key >> 24, record->length & 0xFF, record->length >> 8
+        };
+        if (record->used) {
+            fwrite(header, 1, sizeof(header), f);
+            fwrite(record->data, 1, record->length, f);
+        }
+    }
+    return fclose(f);
+}
+
+/* Resources */
+
+uint8_t g_resource[MAX_RESOURCE];
+size_t g_resource_size = 0;
+
+// The only resource is the land map
+ResHandle resource_get_handle(uint32_t resource_id) {
+    FILE *f;
+
+    if (resource_id != RESOURCE_ID_WORLD_MAP) {
+        return NULL;
+    }
+    if (!g_resource_size) {
+        f = fopen(g_host.land_map_path, "rb");
+        if (!f) {
+            fprintf(stderr, "can't open %s\n", g_host.land_map_path);
+            exit(1);
+        }
+        g_resource_size = fread(g_resource, 1, sizeof(g_resource), f);
+        fclose(f);
+    }
+    return g_resource;
+}
+
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer,
+        size_t num_bytes) {
+    if (!h || start_offset >= g_resource_size) {
+        return 0;
+    }
+    if (num_bytes > g_resource_size - start_offset) {
+        num_bytes = g_resource_size - start_offset;
+    }
+    memcpy(buffer, &h[start_offset], num_bytes);
+    return num_bytes;
+}
+
+/* Event loop */
+
+void click(Button *button, ClickHandler handler) {
+    if (handler) {
+        enter_app();
+        handler((ClickRecognizerRef)button, window_stack_get_top_window());
+        leave_app();
+    }
+}
+
+// Raw handlers get their own context, if they were given one
+void raw_click(Button *button, ClickHandler handler) {
+    if (handler) {
+        enter_app();
+        handler((ClickRecognizerRef)button,
+                button->raw_context ? button->raw_context : window_stack_get_top_window());
+        leave_app();
+    }
+}
+
+// Raw handlers come on the press and the release, before anything else.
+// Single clicks come on the press, unless the button also has a long click,
+// in which case they come on a release before the long click fires. BACK
+// without a click of its own closes the window.
+void press(ButtonId button_id) {
+    Button *button = &g_buttons[button_id];
+
+    if (button->held) {
+        return;
+    }
+    button->held = 1;
+    button->long_fired = 0;
+    raw_click(button, button->raw_down);
+    if (has_long_click(button)) {
+        button->long_due = g_now + button->long_ms;
+    } else if (button->single) {
+        button->next_repeat = g_now + button->repeat_ms;
+        click(button, button->single);
+    } else if (button_id == BUTTON_ID_BACK && !button->raw_down) {
+        window_stack_pop(true);
+    }
+}
+
+void release(ButtonId button_id) {
+    Button *button = &g_buttons[button_id];
+
+    if (!button->held) {
+        return;
+    }
+    button->held = 0;
+    raw_click(button, button->raw_up);
+    if (has_long_click(button)) {
+        click(button, button->long_fired ? button->long_up : button->single);
+    }
+}
+
+// The held button with a repeat or long click due first
+Button *next_button(uint32_t *due) {
+    Button *next = NULL;
+    int i;
+
+    *due = NEVER;
+    for (i = 0; i < NUM_BUTTONS; i++) {
+        Button *button = &g_buttons[i];
+        uint32_t button_due = NEVER;
+        if (!button->held) {
+            continue;
+        }
+        if (has_long_click(button)) {
+            if (!button->long_fired) button_due = button->long_due;
+        } else if (button->single && button->repeat_ms) {
+            button_due = button->next_repeat;
+        }
+        if (button_due < *due) {
+            *due = button_due;
+            next = button;
+        }
+    }
+    return next;
+}
+
+void handle_event(const HostEvent *event) {
+    if (g_host.event) {
+        g_host.event(event, g_now);
+    }
+    switch (event->type) {
+    case HOST_PRESS:
+        press((ButtonId)event->value);
+        break;
+    case HOST_RELEASE:
+        release((ButtonId)event->value);
+        break;
+    case HOST_BATTERY:
+        g_battery.charge_percent = event->value;
+        break;
+    case HOST_CHARGING:
+        g_battery.is_charging = g_battery.is_plugged = event->value != 0;
+        break;
+    case HOST_FOCUS:
+        if (g_focus_handler) {
+            enter_app();
+            g_focus_handler(event->value != 0);
+            leave_app();
+        }
+        break;
+    }
+}
+
+// Run until the events run out or one of them quits, then close every
+// window, as when the user leaves the app
+void app_event_loop(void) {
+    int next_event = 0;
+
+    redraw();
+    while (g_stack_size > 0 && next_event < g_host.event_count) {
+        uint32_t event_due = g_host.events[next_event].time;
+        uint32_t button_due, tick_due = next_tick();
+        Button *button = next_button(&button_due);
+        Timer *timer = next_timer();
+        uint32_t timer_due = timer ? timer->due : NEVER;
+
+        // Whatever is due first; at the same time, in the order below
+        if (event_due <= button_due && event_due <= timer_due &&
+                event_due <= g_next_animation_frame && event_due <= tick_due) {
+            const HostEvent *event = &g_host.events[next_event++];
+            if (event_due > g_now) g_now = event_due;
+            handle_event(event);
+            if (event->type == HOST_QUIT) {
+                break;
+            }
+        } else if (button_due <= timer_due && button_due <= g_next_animation_frame &&
+                button_due <= tick_due) {
+            if (button_due > g_now) g_now = button_due;
+            if (has_long_click(button)) {
+                button->long_fired = 1;
+                click(button, button->long_down);
+            } else {
+                button->next_repeat += button->repeat_ms;
+                click(button, button->single);
+            }
+        } else if (timer_due <= g_next_animation_frame && timer_due <= tick_due) {
+            AppTimerCallback callback = timer->callback;
+            void *data = timer->data;
+            if (timer_due > g_now) g_now = timer_due;
+            timer->id = 0;
+            g_host_stats.wakeups++;
+            enter_app();
+            callback(data);
+            leave_app();
+        } else if (g_next_animation_frame <= tick_due) {
+            if (g_next_animation_frame > g_now) g_now = g_next_animation_frame;
+            step_animations();
+        } else {
+            if (tick_due > g_now) g_now = tick_due;
+            tick();
+        }
+        redraw();
+    }
+
+    while (g_stack_size > 0) {
+        window_stack_pop(false);
+    }
+}
@@ -0,0 +1,492 @@
+// Runs the whole app on the host, against a scripted timeline of button
+// presses, battery and focus changes, through the Pebble SDK stand-in in
+// tools/host/. src/pebble-worldmap.c, src/settings.c and src/frame_cache.c
+// are built unmodified, except that the app's main() is renamed app_main().
+//
+// Time is virtual, and by default the app's code takes none of it, so a run
+// is repeatable: the same script gives the same frames. With -c, each ms of
+// host CPU time the app spends counts as SCALE ms, which gives the watch's
+// timing roughly (it's a few tens of times slower).
+//
+// For each press (and return of focus) the time until the screen first
+// changes is reported, along with the host time per redraw, how often the
+// app woke the watch and what it wrote to flash.
+//
+// The script has one event per line, with # comments:
+//   TIME EVENT [ARGS]
+// TIME is from the start, or from the previous line with a leading +, in ms
+// or with an s, m or h suffix (e.g. +1.5s, 10m). The events are:
+//   click BUTTON            press BUTTON and release it 50 ms later
+//   hold BUTTON DURATION    press BUTTON and release it after DURATION
+//   press BUTTON
+//   release BUTTON
+//   battery PERCENT
+//   charging on|off
+//   focus on|off            off while a notification covers the app
+//   quit
+// where BUTTON is back, up, select or down. The app is closed at the quit,
+// or after the last event.
+//
+// Lines of the form
+//   expect COUNTER [<=|>=] VALUE
+// are checked once the app has closed, and sim exits with 1 if any doesn't
+// hold. COUNTER is one of frames, wakeups, writes (to persistent storage),
+// bytes (written), vibes, refreshes (of the overlay), full (refreshes that
+// rendered the whole map) or unchanged (presses that never changed the
+// screen).
+//
+// usage: sim [-s START] [-c SCALE] [-o DIR] [-p FILE] [-a] [-v] SCRIPT
+//   -s  local time at the start, as "YYYY-MM-DD HH:MM[:SS]", by default
+//       2026-03-20 12:00
+//   -c  virtual ms per ms of host CPU time in the app, 0 by default
+//   -o  write each frame as DIR/NNNNN.pbm
+//   -p  persistent storage file, read at the start and written at the end;
+//       without it the app starts with empty storage, as if just installed
+//   -a  12-hour clock
+//   -v  print each frame, the text drawn on it and the app's log
+// SCRIPT can be - for stdin.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host.h"
+
+#ifndef LAND_MAP_PATH
+#define LAND_MAP_PATH "../resources/data/world_map.rle"
+#endif
+
+#define MAX_EVENTS 4096
+#define MAX_EXPECTS 32
+#define MAX_PENDING 64
+#define TEXT_BYTES 2048
+#define CLICK_MS 50
+
+#define FRAME_BYTES (SCREEN_HEIGHT * HOST_ROW_BYTES)
+#define RASTER_ROW ((SCREEN_WIDTH + 7) / 8)
+
+const char *BUTTONS[NUM_BUTTONS] = {"back", "up", "select", "down"};
+
+// The script, in order of time
+HostEvent g_events[MAX_EVENTS];
+int g_event_count = 0;
+
+int g_verbose = 0;
+const char *g_frame_dir = 0;
+
+// What's on screen: the frame, and the text drawn on it, which the stand-in
+// doesn't rasterise, as lines of "x,y "text""
+typedef struct {
+    uint8_t pixels[FRAME_BYTES];
+    char text[TEXT_BYTES];
+} Screen;
+
+Screen g_shown;
+
+// Text drawn on the frame in progress
+char g_text[TEXT_BYTES];
+
+// Events waiting for the screen to change from how it was when they happened
+typedef struct {
+    HostEvent event;
+    uint32_t time;
+    Screen before;
+} Pending;
+
+Pending g_pending[MAX_PENDING];
+int g_pending_count = 0;
+
+// Host time per frame
+long long g_cost_min = -1;
+long long g_cost_max = 0;
+long long g_cost_total = 0;
+
+// Byte with its bits reversed, and inverted, as in tools/batch.c
+uint8_t g_raster_byte[256];
+
+// The app's count of overlay refreshes, in src/pebble-worldmap.c
+extern int g_refreshes;
+extern int g_full_renders;
+
+// What a script can expect the value of at the end
+typedef struct {
+    const char *name;
+    const int *count;
+} Counter;
+
+const Counter COUNTERS[] = {
+    {"frames", &g_host_stats.frames},
+    {"wakeups", &g_host_stats.wakeups},
+    {"writes", &g_host_stats.persist_writes},
+    {"bytes", &g_host_stats.persist_bytes},
+    {"vibes", &g_host_stats.vibes},
+    {"refreshes", &g_refreshes},
+    {"full", &g_full_renders},
+    {"unchanged", &g_pending_count},
+};
+#define COUNTER_COUNT (int)(sizeof(COUNTERS) / sizeof(COUNTERS[0]))
+
+// The script's expectations, and the line each is on. The count is to be at
+// most (compare -1), exactly (0) or at least (1) value.
+typedef struct {
+    const Counter *counter;
+    int compare;
+    int value;
+    int line;
+} Expect;
+
+Expect g_expects[MAX_EXPECTS];
+int g_expect_count = 0;
+
+void describe(const HostEvent *event, char *buf, int size) {
+    switch (event->type) {
+    case HOST_PRESS: snprintf(buf, size, "press %s", BUTTONS[event->value]); break;
+    case HOST_RELEASE: snprintf(buf, size, "release %s", BUTTONS[event->value]); break;
+    case HOST_BATTERY: snprintf(buf, size, "battery %d%%", event->value); break;
+    case HOST_CHARGING: snprintf(buf, size, "charging %s", event->value ? "on" : "off"); break;
+    case HOST_FOCUS: snprintf(buf, size, "focus %s", event->value ? "on" : "off"); break;
+    default: snprintf(buf, size, "quit"); break;
+    }
+}
+
+int write_pbm(const uint8_t *pixels) {
+    uint8_t raster[SCREEN_HEIGHT * RASTER_ROW];
+    char path[4096];
+    int x, y;
+    FILE *f;
+
+    for (y = 0; y < SCREEN_HEIGHT; y++) {
+        for (x = 0; x < RASTER_ROW; x++) {
+            raster[y * RASTER_ROW + x] = g_raster_byte[pixels[y * HOST_ROW_BYTES + x]];
+        }
+        if (SCREEN_WIDTH & 7) {
+            raster[y * RASTER_ROW + RASTER_ROW - 1] &= (uint8_t)(0xFF << (8 - (SCREEN_WIDTH & 7)));
+        }
+    }
+
+    snprintf(path, sizeof(path), "%s/%05d.pbm", g_frame_dir, g_host_stats.frames);
+    f = fopen(path, "wb");
+    if (!f) {
+        return -1;
+    }
+    fprintf(f, "P4\n%d %d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    fwrite(raster, 1, sizeof(raster), f);
+    return fclose(f);
+}
+
+void on_frame(const uint8_t *pixels, uint32_t time, long long cost_ns) {
+    int i, j;
+
+    if (g_cost_min < 0 || cost_ns < g_cost_min) g_cost_min = cost_ns;
+    if (cost_ns > g_cost_max) g_cost_max = cost_ns;
+    g_cost_total += cost_ns;
+    if (g_verbose) {
+        printf("%9u ms  frame %d, %.3f ms\n%s", time, g_host_stats.frames, cost_ns / 1e6, g_text);
+    }
+    if (g_frame_dir && write_pbm(pixels) < 0) {
+        fprintf(stderr, "can't write frames to %s\n", g_frame_dir);
+        exit(1);
+    }
+
+    // Report the events this frame is the first change since
+    for (i = j = 0; i < g_pending_count; i++) {
+        Pending *pending = &g_pending[i];
+        if (memcmp(pending->before.pixels, pixels, FRAME_BYTES) != 0 ||
+                strcmp(pending->before.text, g_text) != 0) {
+            char name[32];
+            describe(&pending->event, name, sizeof(name));
+            printf("%9u ms  %-16s %6u ms to frame %d\n", pending->time, name,
+                    time - pending->time, g_host_stats.frames);
+        } else {
+            if (i != j) g_pending[j] = *pending;
+            j++;
+        }
+    }
+    g_pending_count = j;
+    memcpy(g_shown.pixels, pixels, FRAME_BYTES);
+    strcpy(g_shown.text, g_text);
+    g_text[0] = 0;
+}
+
+void on_event(const HostEvent *event, uint32_t time) {
+    char name[32];
+    describe(event, name, sizeof(name));
+    if (g_verbose) {
+        printf("%9u ms  %s\n", time, name);
+    }
+    if ((event->type == HOST_PRESS || (event->type == HOST_FOCUS && event->value)) &&
+            g_pending_count < MAX_PENDING) {
+        Pending *pending = &g_pending[g_pending_count++];
+        pending->event = *event;
+        pending->time = time;
+        pending->before = g_shown;
+    }
+}
+
+void on_text(const char *text, GRect box) {
+    int length = strlen(g_text);
+    snprintf(g_text + length, sizeof(g_text) - length, "%14s%4d,%-4d \"%s\"\n", "",
+            box.origin.x, box.origin.y, text);
+}
+
+void on_log(uint32_t time, const char *message) {
+    if (g_verbose) {
+        printf("%9u ms  log: %s\n", time, message);
+    }
+}
+
+// A duration in ms, with an optional s, m or h suffix. Returns -1 if it
+// isn't one.
+double parse_duration(const char *text) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || value < 0) return -1;
+    if (!strcmp(end, "") || !strcmp(end, "ms")) return value;
+    if (!strcmp(end, "s")) return value * 1000;
+    if (!strcmp(end, "m")) return value * 60000;
+    if (!strcmp(end, "h")) return value * 3600000;
+    return -1;
+}
+
+int parse_button(const char *text) {
+    int i;
+    for (i = 0; text && i < NUM_BUTTONS; i++) {
+        if (!strcmp(text, BUTTONS[i])) return i;
+    }
+    return -1;
+}
+
+int parse_switch(const char *text) {
+    if (text && !strcmp(text, "on")) return 1;
+    if (text && !strcmp(text, "off")) return 0;
+    return -1;
+}
+
+// Add an event to the script, after any others at the same time
+int add_event(double at, int type, int value) {
+    int i;
+    if (g_event_count == MAX_EVENTS || at >= 0xFFFFFFF0) {
+        return -1;
+    }
+    for (i = g_event_count; i > 0 && g_events[i - 1].time > (uint32_t)at; i--) {
+        g_events[i] = g_events[i - 1];
+    }
+    g_events[i].time = (uint32_t)at;
+    g_events[i].type = type;
+    g_events[i].value = value;
+    g_event_count++;
+    return 0;
+}
+
+// Add an expectation of the counter of that name. compare is NULL, "<=" or
+// ">=".
+int add_expect(const char *name, const char *compare, const char *value, int line) {
+    Expect *expect = &g_expects[g_expect_count];
+    char *end;
+    int i;
+
+    if (g_expect_count == MAX_EXPECTS || !name || !value) {
+        return -1;
+    }
+    if (!compare) {
+        expect->compare = 0;
+    } else if (!strcmp(compare, "<=")) {
+        expect->compare = -1;
+    } else if (!strcmp(compare, ">=")) {
+        expect->compare = 1;
+    } else {
+        return -1;
+    }
+    for (i = 0; i < COUNTER_COUNT && strcmp(name, COUNTERS[i].name); i++) {
+    }
+    if (i == COUNTER_COUNT) {
+        return -1;
+    }
+    expect->counter = &COUNTERS[i];
+    expect->value = strtol(value, &end, 10);
+    expect->line = line;
+    if (end == value || *end) {
+        return -1;
+    }
+    g_expect_count++;
+    return 0;
+}
+
+// Check the expectations, saying which don't hold. Returns how many don't.
+int check_expects(const char *path) {
+    int i, failed = 0;
+
+    for (i = 0; i < g_expect_count; i++) {
+        const Expect *expect = &g_expects[i];
+        int count = *expect->counter->count;
+        int compare = (count > expect->value) - (count < expect->value);
+        if (compare != expect->compare && compare != 0) {
+            fprintf(stderr, "%s:%d: expected %s %s%d, got %d\n", path, expect->line,
+                    expect->counter->name, (expect->compare < 0) ? "<= " :
+                    (expect->compare > 0) ? ">= " : "", expect->value, count);
+            failed++;
+        }
+    }
+    return failed;
+}
+
+// Read the script into g_events. Returns -1, having said why, if it can't.
+int read_script(const char *path) {
+    FILE *f = strcmp(path, "-") ? fopen(path, "r") : stdin;
+    char line[256];
+    double now = 0;
+    int number = 0;
+
+    if (!f) {
+        fprintf(stderr, "can't open %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        char *when, *name, *arg, *arg2;
+        double at, duration = 0;
+        int value = 0, ok;
+
+        number++;
+        if (strchr(line, '#')) *strchr(line, '#') = 0;
+        when = strtok(line, " \t\r\n");
+        if (!when) continue;
+        name = strtok(NULL, " \t\r\n");
+        arg = strtok(NULL, " \t\r\n");
+        arg2 = strtok(NULL, " \t\r\n");
+
+        if (!strcmp(when, "expect")) {
+            if ((arg2 ? add_expect(name, arg, arg2, number) : add_expect(name, NULL, arg, number)) < 0 ||
+                    strtok(NULL, " \t\r\n")) {
+                fprintf(stderr, "%s:%d: bad expectation\n", path, number);
+                return -1;
+            }
+            continue;
+        }
+
+        at = parse_duration(when + (when[0] == '+'));
+        if (at >= 0) {
+            now = (when[0] == '+') ? now + at : at;
+        }
+
+        ok = at >= 0 && name;
+        if (!ok) {
+        } else if (!strcmp(name, "click")) {
+            ok = (value = parse_button(arg)) >= 0 &&
+                add_event(now, HOST_PRESS, value) == 0 &&
+                add_event(now + CLICK_MS, HOST_RELEASE, value) == 0;
+        } else if (!strcmp(name, "hold")) {
+            ok = (value = parse_button(arg)) >= 0 && arg2 &&
+                (duration = parse_duration(arg2)) >= 0 &&
+                add_event(now, HOST_PRESS, value) == 0 &&
+                add_event(now + duration, HOST_RELEASE, value) == 0;
+        } else if (!strcmp(name, "press") || !strcmp(name, "release")) {
+            ok = (value = parse_button(arg)) >= 0 &&
+                add_event(now, (name[0] == 'p') ? HOST_PRESS : HOST_RELEASE, value) == 0;
+        } else if (!strcmp(name, "battery")) {
+            ok = arg && (value = atoi(arg)) >= 0 && value <= 100 &&
+                add_event(now, HOST_BATTERY, value) == 0;
+        } else if (!strcmp(name, "charging") || !strcmp(name, "focus")) {
+            ok = (value = parse_switch(arg)) >= 0 &&
+                add_event(now, (name[0] == 'c') ? HOST_CHARGING : HOST_FOCUS, value) == 0;
+        } else if (!strcmp(name, "quit")) {
+            ok = add_event(now, HOST_QUIT, 0) == 0;
+        } else {
+            ok = 0;
+        }
+        if (!ok) {
+            fprintf(stderr, "%s:%d: bad event\n", path, number);
+            return -1;
+        }
+    }
+    if (f != stdin) {
+        fclose(f);
+    }
+    return 0;
+}
+
+void usage() {
+    fprintf(stderr, "usage: sim [-s START] [-c SCALE] [-o DIR] [-p FILE] [-a] [-v] SCRIPT\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    const char *persist_path = 0;
+    const char *start = "2026-03-20 12:00";
+    struct tm start_tm;
+    uint32_t end;
+    int opt, i, failed;
+
+    while ((opt = getopt(argc, argv, "s:c:o:p:av")) != -1) {
+        switch (opt) {
+        case 's': start = optarg; break;
+        case 'c': g_host.cpu_scale = atof(optarg); break;
+        case 'o': g_frame_dir = optarg; break;
+        case 'p': persist_path = optarg; break;
+        case 'a': g_host.clock_24h = 0; break;
+        case 'v': g_verbose = 1; break;
+        default: usage();
+        }
+    }
+    if (optind != argc - 1 || g_host.cpu_scale < 0) {
+        usage();
+    }
+
+    memset(&start_tm, 0, sizeof(start_tm));
+    if (sscanf(start, "%d-%d-%d %d:%d:%d", &start_tm.tm_year, &start_tm.tm_mon,
+                &start_tm.tm_mday, &start_tm.tm_hour, &start_tm.tm_min, &start_tm.tm_sec) < 5) {
+        usage();
+    }
+    start_tm.tm_year -= 1900;
+    start_tm.tm_mon -= 1;
+    g_host.start = timegm(&start_tm);
+
+    if (read_script(argv[optind]) < 0) {
+        return 1;
+    }
+    if (persist_path && host_load_persist(persist_path) < 0) {
+        fprintf(stderr, "can't read %s\n", persist_path);
+        return 1;
+    }
+
+    for (i = 0; i < 256; i++) {
+        int bit, reversed = 0;
+        for (bit = 0; bit < 8; bit++) {
+            reversed |= ((i >> bit) & 1) << (7 - bit);
+        }
+        g_raster_byte[i] = ~reversed;
+    }
+
+    g_host.land_map_path = LAND_MAP_PATH;
+    g_host.events = g_events;
+    g_host.event_count = g_event_count;
+    g_host.frame = on_frame;
+    g_host.event = on_event;
+    g_host.text = on_text;
+    g_host.log = on_log;
+
+    app_main();
+    end = host_now();
+
+    for (i = 0; i < g_pending_count; i++) {
+        char name[32];
+        describe(&g_pending[i].event, name, sizeof(name));
+        printf("%9u ms  %-16s no change\n", g_pending[i].time, name);
+    }
+    printf("%d frames in %u ms, host time per frame %.3f/%.3f/%.3f ms min/mean/max\n",
+            g_host_stats.frames, end, (g_cost_min < 0) ? 0 : g_cost_min / 1e6,
+            g_host_stats.frames ? g_cost_total / 1e6 / g_host_stats.frames : 0,
+            g_cost_max / 1e6);
+    printf("%d wakeups, %d persist writes (%d bytes), %d vibes\n", g_host_stats.wakeups,
+            g_host_stats.persist_writes, g_host_stats.persist_bytes, g_host_stats.vibes);
+    failed = check_expects(argv[optind]);
+
+    if (persist_path && host_save_persist(persist_path) < 0) {
+        fprintf(stderr, "can't write %s\n", persist_path);
+        return 1;
+    }
+    return failed ? 1 : 0;
+}